@@ -0,0 +1,327 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Benchmark workload.
+ *
+ * Renders frames of a typical animated diagram and reports the time spent
+ * in each kind of drawing operation. This is also the training workload
+ * for profile guided optimisation builds.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+
+#include <cgifh.h>
+
+/** Benchmark image width in pixels. */
+#define BENCH_WIDTH  1024
+/** Benchmark image height in pixels. */
+#define BENCH_HEIGHT 768
+
+/**
+ * Get the number of elements in an array.
+ *
+ * \param[in] _a The array to get the number of elements in.
+ * \return The number of elements in the array.
+ */
+#define BENCH_ARRAY_LEN(_a) (sizeof(_a) / sizeof((_a)[0]))
+
+/** Default number of frames to render. */
+#define BENCH_FRAMES 200
+
+/** Number of points drawn per frame. */
+#define BENCH_POINTS_COUNT 20000
+
+/**
+ * Scatter plot data.
+ */
+static struct bench_points {
+	int xs[BENCH_POINTS_COUNT];          /**< Point x coordinates. */
+	int ys[BENCH_POINTS_COUNT];          /**< Point y coordinates. */
+	uint8_t colours[BENCH_POINTS_COUNT]; /**< Point colours. */
+} bench_points;
+
+/** Heat map grid width in cells. */
+#define BENCH_GRID_W 64
+/** Heat map grid height in cells. */
+#define BENCH_GRID_H 48
+
+/** Heat map grid values. */
+static float bench_grid[BENCH_GRID_W * BENCH_GRID_H];
+
+/**
+ * Benchmark sections.
+ */
+enum bench_section {
+	BENCH_CLEAR,
+	BENCH_FILL,
+	BENCH_LINES,
+	BENCH_TEXT,
+	BENCH_POINTS,
+	BENCH_HEATMAP,
+	BENCH_SECTION_COUNT,
+};
+
+/** Names of the benchmark sections. */
+static const char *const bench_section_names[BENCH_SECTION_COUNT] = {
+	[BENCH_CLEAR]   = "clear",
+	[BENCH_FILL]    = "fill",
+	[BENCH_LINES]   = "lines",
+	[BENCH_TEXT]    = "text",
+	[BENCH_POINTS]  = "points",
+	[BENCH_HEATMAP] = "heatmap",
+};
+
+/** Labels drawn in the text section. */
+static const char *const bench_labels[] = {
+	"Throughput (req/s)",
+	"Latency: p50, p90, p99",
+	"The quick brown fox jumps over the lazy dog.",
+	"0123456789",
+	"[cache] {hits} misses?",
+};
+
+/** Paragraph laid out in the text section. */
+static const char bench_paragraph[] =
+	"Requests are grouped by endpoint and sampled once per second. "
+	"Latency percentiles are computed over a sliding window.\n"
+	"Values above the threshold are drawn in red.";
+
+/**
+ * Get the current time in seconds.
+ *
+ * \return Monotonic time in seconds.
+ */
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+/**
+ * Render one frame of the workload.
+ *
+ * \param[in]  img   Image to render into.
+ * \param[in]  cache Text layout cache.
+ * \param[in]  atlas Glyph atlas of the built-in font at scale 2.
+ * \param[in]  frame Frame number.
+ * \param[out] times Array to accumulate section times into.
+ */
+static void bench_frame(
+		cgifh_t *img,
+		cgifh_text_cache_t *cache,
+		const cgifh_atlas_t *atlas,
+		int frame,
+		double *times)
+{
+	double t0;
+	double t1;
+	int scale;
+
+	t0 = bench_now();
+	cgifh_clear(img, 0);
+	t1 = bench_now();
+	times[BENCH_CLEAR] += t1 - t0;
+
+	cgifh_rect_fill_checker(img, 0, 1, 16, 0, 0, BENCH_WIDTH, 64);
+	cgifh_rect_fill_h_stripes(img, 0, 1, 4, 0, 64, 128, 640);
+	cgifh_rect_fill_v_stripes(img, 0, 1, 3, 896, 64, 128, 640);
+	cgifh_rect_fill_dither(img, 2, 3, (uint8_t) frame, 128, 704,
+			768, 64);
+	cgifh_rect_fill_gradient(img, CGIFH_DITHER_ORDERED,
+			(const uint8_t[]) { 0xcc, 0x33, 0x33 },
+			(const uint8_t[]) { 0x33, 0x33, 0xcc },
+			frame & 1, 128, 0, 768, 64);
+	for (int i = 0; i < 32; i++) {
+		cgifh_rect_fill(img, (uint8_t) (2 + i % 4),
+				160 + i * 22, 600 - (frame * 7 + i * 37) % 500,
+				18, (frame * 7 + i * 37) % 500);
+	}
+	t0 = bench_now();
+	times[BENCH_FILL] += t0 - t1;
+
+	for (int x = 128; x < 896; x += 32) {
+		cgifh_v_line(img, 1, 64, 704, x);
+	}
+	for (int y = 64; y < 704; y += 32) {
+		cgifh_h_line(img, 1, 128, 896, y);
+	}
+	for (int i = 0; i < 64; i++) {
+		cgifh_line(img, (uint8_t) (2 + i % 4),
+				-50 + i * 17, (frame + i * 13) % BENCH_HEIGHT,
+				(frame * 3 + i * 29) % BENCH_WIDTH,
+				BENCH_HEIGHT + 50 - i * 11);
+	}
+	t1 = bench_now();
+	times[BENCH_LINES] += t1 - t0;
+
+	scale = 1;
+	for (size_t i = 0; i < 4 * BENCH_ARRAY_LEN(bench_labels); i++) {
+		const char *label = bench_labels[i %
+				BENCH_ARRAY_LEN(bench_labels)];
+		int w = cgifh_text_width(label, scale);
+		int y = (int) i * 36 % BENCH_HEIGHT;
+
+		cgifh_text(img, 1, label, scale, 0, y);
+		cgifh_text(img, 1, label, scale, (BENCH_WIDTH - w) / 2, y);
+		cgifh_text(img, 1, label, scale, BENCH_WIDTH - w, y);
+		cgifh_text(img, 1, label, scale, frame - w, y + 16);
+		scale = scale % 3 + 1;
+	}
+	for (int i = 0; i < 3; i++) {
+		const cgifh_layout_t *layout = cgifh_text_layout(cache,
+				&(const cgifh_text_style_t) {
+					.scale = 1 + i % 2,
+					.align = (cgifh_align_t) i,
+				}, bench_paragraph, 320);
+
+		if (layout != NULL) {
+			cgifh_layout_draw(img, 1, layout,
+					32 + i * 336, 200 + frame % 64);
+			cgifh_layout_release(layout);
+		}
+	}
+	for (size_t i = 0; i < BENCH_ARRAY_LEN(bench_labels); i++) {
+		cgifh_atlas_text(img, 1, atlas, bench_labels[i],
+				frame % 256, 400 + (int) i * 20);
+	}
+	cgifh_text_box(img, 1, &(const cgifh_text_style_t) {
+				.align = CGIFH_ALIGN_CENTRE,
+			}, bench_paragraph, 64 + frame % 128, 500, 200, 40);
+	for (size_t i = 0; i < 8; i++) {
+		cgifh_text_box(img, 1, &(const cgifh_text_style_t) {
+					.effects = {
+						.flags = CGIFH_TEXT_OUTLINE |
+						         CGIFH_TEXT_SHADOW,
+						.outline = 0,
+						.shadow = 5,
+					},
+				}, bench_labels[i % BENCH_ARRAY_LEN(bench_labels)],
+				(frame * 5 + (int) i * 97) % BENCH_WIDTH,
+				64 + (int) i * 80,
+				256, 16);
+	}
+	for (size_t i = 0; i < BENCH_ARRAY_LEN(bench_labels); i++) {
+		cgifh_text_rotated(img, 1, bench_labels[i], 1 + (int) i % 2,
+				CGIFH_ROTATE_270, 100 + (int) i * 20,
+				64 + frame % 256);
+	}
+	t0 = bench_now();
+	times[BENCH_TEXT] += t0 - t1;
+
+	for (int i = 0; i < BENCH_POINTS_COUNT; i++) {
+		bench_points.xs[i] = (i * 7919 + frame * 3) %
+				(BENCH_WIDTH + 20) - 10;
+		bench_points.ys[i] = (i * 104729 + frame) %
+				(BENCH_HEIGHT + 20) - 10;
+		bench_points.colours[i] = (uint8_t) (2 + i % 4);
+	}
+	t1 = bench_now();
+	cgifh_points(img, 1, NULL, bench_points.xs, bench_points.ys,
+			BENCH_POINTS_COUNT, CGIFH_MARKER_SQUARE, 1);
+	cgifh_points(img, 1, bench_points.colours,
+			bench_points.xs, bench_points.ys,
+			BENCH_POINTS_COUNT / 4, CGIFH_MARKER_PLUS, 5);
+	t0 = bench_now();
+	times[BENCH_POINTS] += t0 - t1;
+
+	for (int i = 0; i < BENCH_GRID_W * BENCH_GRID_H; i++) {
+		bench_grid[i] = (float) ((i * 31 + frame * 17) % 1000);
+	}
+	t1 = bench_now();
+	cgifh_heatmap_float(img, &(const cgifh_heatmap_t) {
+				.min = 0, .max = 1000,
+				.first = 2, .count = 4,
+				.sample = CGIFH_HEATMAP_NEAREST,
+			}, bench_grid, BENCH_GRID_W, BENCH_GRID_H,
+			BENCH_GRID_W, 0, 0, BENCH_WIDTH / 2, BENCH_HEIGHT);
+	cgifh_heatmap_float(img, &(const cgifh_heatmap_t) {
+				.min = 1, .max = 1000,
+				.first = 2, .count = 4,
+				.scale = CGIFH_HEATMAP_LOG,
+				.sample = CGIFH_HEATMAP_DITHER,
+			}, bench_grid, BENCH_GRID_W, BENCH_GRID_H,
+			BENCH_GRID_W, BENCH_WIDTH / 2, 0,
+			BENCH_WIDTH / 2, BENCH_HEIGHT);
+	t0 = bench_now();
+	times[BENCH_HEATMAP] += t0 - t1;
+}
+
+/**
+ * Benchmark entry point.
+ *
+ * \param[in] argc Number of command line arguments.
+ * \param[in] argv Command line arguments; optional frame count.
+ * \return Program exit code.
+ */
+int main(int argc, char *argv[])
+{
+	double times[BENCH_SECTION_COUNT] = { 0 };
+	int frames = BENCH_FRAMES;
+	cgifh_atlas_t *atlas;
+	cgifh_ctx_t *ctx;
+	double total = 0;
+	cgifh_t *img;
+
+	if (argc > 1 && sscanf(argv[1], "%d", &frames) != 1) {
+		fprintf(stderr, "Usage: %s [FRAMES]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	ctx = cgifh_ctx_create(&(const cgifh_ctx_config_t) {
+		.text_cache_capacity = 16,
+	});
+	if (ctx == NULL) {
+		fprintf(stderr, "Failed to create render context\n");
+		return EXIT_FAILURE;
+	}
+
+	img = cgifh_ctx_create_image(ctx, BENCH_WIDTH, BENCH_HEIGHT);
+	if (img == NULL) {
+		fprintf(stderr, "Failed to create image\n");
+		cgifh_ctx_destroy(ctx);
+		return EXIT_FAILURE;
+	}
+
+	atlas = cgifh_atlas_create(NULL, 2);
+	if (atlas == NULL) {
+		fprintf(stderr, "Failed to create glyph atlas\n");
+		cgifh_destroy(img);
+		cgifh_ctx_destroy(ctx);
+		return EXIT_FAILURE;
+	}
+
+	cgifh_palette_add(img, 0xff, 0xff, 0xff, NULL);
+	cgifh_palette_add(img, 0x00, 0x00, 0x00, NULL);
+	cgifh_palette_add(img, 0xcc, 0x33, 0x33, NULL);
+	cgifh_palette_add(img, 0x33, 0xcc, 0x33, NULL);
+	cgifh_palette_add(img, 0x33, 0x33, 0xcc, NULL);
+	cgifh_palette_add(img, 0xcc, 0xcc, 0x33, NULL);
+
+	for (int frame = 0; frame < frames; frame++) {
+		bench_frame(img, cgifh_ctx_text_cache(ctx), atlas, frame,
+				times);
+	}
+
+	for (int i = 0; i < BENCH_SECTION_COUNT; i++) {
+		printf("%-8s %10.3f ms\n", bench_section_names[i],
+				times[i] * 1000);
+		total += times[i];
+	}
+	printf("%-8s %10.3f ms (%d frames)\n", "total", total * 1000, frames);
+
+	cgifh_atlas_destroy(atlas);
+	cgifh_destroy(img);
+	cgifh_ctx_destroy(ctx);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,4750 @@
+/* Generated by tools/fontc from src/font.c. Do not edit. */
+
+#include "font.h"
+
+/** Spans of the built-in font's glyphs. */
+static const cgifh_glyph_span_t font_h8_spans[] = {
+	/* '!' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* '"' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	/* '#' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* '$' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	{ .row = 6, .x0 = 2, .x1 = 3 },
+	/* '%' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 5 },
+	/* '&' */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* ''' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	/* '(' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 1, .x1 = 2 },
+	/* ')' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* 0x2a */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* '+' */
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	/* ',' */
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* '-' */
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	/* '.' */
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 0x2f */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* '0' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '1' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '2' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* '3' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '4' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 4 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* '5' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '6' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '7' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* '8' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* '9' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 5 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* ':' */
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* ';' */
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* '<' */
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 1, .x1 = 3 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* '=' */
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 4 },
+	/* '>' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 1, .x1 = 3 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* '?' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* '@' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 1, .x1 = 5 },
+	/* 'A' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'B' */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* 'C' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'D' */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* 'E' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* 'F' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 'G' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'H' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'I' */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* 'J' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* 'K' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'L' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* 'M' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	/* 'N' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'O' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'P' */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 'Q' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 2, .x1 = 5 },
+	/* 'R' */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'S' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* 'T' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* 'U' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'V' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* 'W' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	/* 'X' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'Y' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* 'Z' */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* '[' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 0, .x1 = 2 },
+	/* 0x5c */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* ']' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 0, .x1 = 2 },
+	/* '^' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	/* '_' */
+	{ .row = 7, .x0 = 0, .x1 = 5 },
+	/* '`' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	/* 'a' */
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'b' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* 'c' */
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'd' */
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* 'e' */
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* 'f' */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 'g' */
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 4 },
+	{ .row = 7, .x0 = 0, .x1 = 3 },
+	/* 'h' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* 'i' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 'j' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 1, .x1 = 2 },
+	{ .row = 7, .x0 = 0, .x1 = 1 },
+	/* 'k' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* 'l' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 'm' */
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'n' */
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* 'o' */
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* 'p' */
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	{ .row = 7, .x0 = 0, .x1 = 1 },
+	/* 'q' */
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 4 },
+	{ .row = 7, .x0 = 3, .x1 = 4 },
+	/* 'r' */
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* 's' */
+	{ .row = 1, .x0 = 1, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* 't' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* 'u' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'v' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* 'w' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* 'x' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'y' */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 4 },
+	{ .row = 7, .x0 = 0, .x1 = 3 },
+	/* 'z' */
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 4 },
+	/* '{' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 2, .x1 = 3 },
+	/* '|' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* '}' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* '~' */
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 4 },
+	/* U+00A1 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* U+00A2 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 4 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* U+00A3 */
+	{ .row = 0, .x0 = 2, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* U+00A4 */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 1, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00A5 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* U+00A6 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* U+00A7 */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 1, .x1 = 3 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	{ .row = 6, .x0 = 0, .x1 = 3 },
+	/* U+00A8 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	/* U+00A9 */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 5 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	{ .row = 6, .x0 = 1, .x1 = 6 },
+	/* U+00AA */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 3 },
+	/* U+00AB */
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	/* U+00AC */
+	{ .row = 2, .x0 = 0, .x1 = 4 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	/* U+00AD */
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	/* U+00AE */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 4 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	{ .row = 6, .x0 = 1, .x1 = 6 },
+	/* U+00AF */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	/* U+00B0 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	/* U+00B1 */
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00B2 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	/* U+00B3 */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	/* U+00B4 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	/* U+00B5 */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	/* U+00B6 */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00B7 */
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	/* U+00B8 */
+	{ .row = 6, .x0 = 1, .x1 = 2 },
+	{ .row = 7, .x0 = 0, .x1 = 1 },
+	/* U+00B9 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	/* U+00BA */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 3 },
+	/* U+00BB */
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* U+00BC */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	{ .row = 5, .x0 = 5, .x1 = 6 },
+	/* U+00BD */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 5 },
+	/* U+00BE */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	{ .row = 5, .x0 = 5, .x1 = 6 },
+	/* U+00BF */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00C0 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C1 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C2 */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C3 */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C4 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C5 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00C6 */
+	{ .row = 0, .x0 = 2, .x1 = 7 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 7 },
+	/* U+00C7 */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 2, .x1 = 3 },
+	{ .row = 7, .x0 = 1, .x1 = 2 },
+	/* U+00C8 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* U+00C9 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* U+00CA */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* U+00CB */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 5 },
+	/* U+00CC */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00CD */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00CE */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00CF */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00D0 */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00D1 */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* U+00D2 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D3 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D4 */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D5 */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D6 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D7 */
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* U+00D8 */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00D9 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00DA */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00DB */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00DC */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00DD */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* U+00DE */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	/* U+00DF */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	/* U+00E0 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E1 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E2 */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E3 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E4 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E5 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00E6 */
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 6 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 1, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 7 },
+	/* U+00E7 */
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 2, .x1 = 3 },
+	{ .row = 7, .x0 = 1, .x1 = 2 },
+	/* U+00E8 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00E9 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00EA */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00EB */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00EC */
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* U+00ED */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* U+00EE */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* U+00EF */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* U+00F0 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F1 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	/* U+00F2 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F3 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F4 */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F5 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F6 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 3 },
+	/* U+00F7 */
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 3 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	/* U+00F8 */
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	/* U+00F9 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00FA */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00FB */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00FC */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	/* U+00FD */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 4 },
+	{ .row = 7, .x0 = 0, .x1 = 3 },
+	/* U+00FE */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 0, .x1 = 3 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	{ .row = 7, .x0 = 0, .x1 = 1 },
+	/* U+00FF */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 1, .x1 = 4 },
+	{ .row = 6, .x0 = 3, .x1 = 4 },
+	{ .row = 7, .x0 = 0, .x1 = 3 },
+};
+
+/** Columns of the built-in font's glyphs. */
+static const cgifh_glyph_span_t font_h8_columns[] = {
+	/* '!' */
+	{ .row = 0, .x0 = 0, .x1 = 4 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	/* '"' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	/* '#' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* '$' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 7 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* '%' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 4, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 6 },
+	/* '&' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* ''' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	/* '(' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	/* ')' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	/* 0x2a */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	/* '+' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* ',' */
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	/* '-' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* '.' */
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	/* 0x2f */
+	{ .row = 0, .x0 = 4, .x1 = 6 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	/* '0' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* '1' */
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* '2' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* '3' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* '4' */
+	{ .row = 0, .x0 = 3, .x1 = 5 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 6 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* '5' */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* '6' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* '7' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	/* '8' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* '9' */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* ':' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	/* ';' */
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	/* '<' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* '=' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	/* '>' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	/* '?' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	/* '@' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 5 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	/* 'A' */
+	{ .row = 0, .x0 = 2, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 2, .x1 = 6 },
+	/* 'B' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* 'C' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* 'D' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* 'E' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'F' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	/* 'G' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	/* 'H' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 6 },
+	/* 'I' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* 'J' */
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 5 },
+	/* 'K' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'L' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* 'M' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 6, .x0 = 0, .x1 = 6 },
+	/* 'N' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 0, .x1 = 6 },
+	/* 'O' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* 'P' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	/* 'Q' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 4, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'R' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 4, .x1 = 6 },
+	/* 'S' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	/* 'T' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	/* 'U' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 5 },
+	/* 'V' */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 1, .x0 = 3, .x1 = 5 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 3 },
+	/* 'W' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 4, .x1 = 5 },
+	{ .row = 6, .x0 = 0, .x1 = 6 },
+	/* 'X' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'Y' */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 0, .x1 = 2 },
+	/* 'Z' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 4, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* '[' */
+	{ .row = 0, .x0 = 0, .x1 = 7 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	/* 0x5c */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 4, .x1 = 6 },
+	/* ']' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 0, .x1 = 7 },
+	/* '^' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* '_' */
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 7, .x1 = 8 },
+	{ .row = 3, .x0 = 7, .x1 = 8 },
+	{ .row = 4, .x0 = 7, .x1 = 8 },
+	/* '`' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	/* 'a' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* 'b' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* 'c' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* 'd' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 6 },
+	/* 'e' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'f' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	/* 'g' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 7, .x1 = 8 },
+	{ .row = 3, .x0 = 2, .x1 = 7 },
+	/* 'h' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* 'i' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 6 },
+	/* 'j' */
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 7 },
+	/* 'k' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* 'l' */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	/* 'm' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 2, .x1 = 6 },
+	/* 'n' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* 'o' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* 'p' */
+	{ .row = 0, .x0 = 1, .x1 = 8 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* 'q' */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 8 },
+	/* 'r' */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	/* 's' */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* 't' */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* 'u' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 6 },
+	/* 'v' */
+	{ .row = 0, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 1, .x1 = 4 },
+	/* 'w' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 2, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* 'x' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* 'y' */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 7, .x1 = 8 },
+	{ .row = 3, .x0 = 1, .x1 = 7 },
+	/* 'z' */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* '{' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	/* '|' */
+	{ .row = 0, .x0 = 0, .x1 = 7 },
+	/* '}' */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* '~' */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* U+00A1 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 6 },
+	/* U+00A2 */
+	{ .row = 0, .x0 = 2, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	/* U+00A3 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00A4 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00A5 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 2, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* U+00A6 */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 7 },
+	/* U+00A7 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 0, .x0 = 6, .x1 = 7 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	/* U+00A8 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	/* U+00A9 */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 6, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	{ .row = 6, .x0 = 1, .x1 = 6 },
+	/* U+00AA */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	/* U+00AB */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	/* U+00AC */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 2, .x1 = 4 },
+	/* U+00AD */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* U+00AE */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 6, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 7 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 6, .x1 = 7 },
+	{ .row = 6, .x0 = 1, .x1 = 6 },
+	/* U+00AF */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	/* U+00B0 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	/* U+00B1 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* U+00B2 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 4 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* U+00B3 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	/* U+00B4 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	/* U+00B5 */
+	{ .row = 0, .x0 = 1, .x1 = 7 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 5 },
+	/* U+00B6 */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 0, .x1 = 6 },
+	/* U+00B7 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	/* U+00B8 */
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 6, .x1 = 7 },
+	/* U+00B9 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* U+00BA */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	/* U+00BB */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	/* U+00BC */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 3, .x1 = 6 },
+	/* U+00BD */
+	{ .row = 0, .x0 = 0, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 7 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 6, .x1 = 7 },
+	/* U+00BE */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	{ .row = 5, .x0 = 3, .x1 = 6 },
+	/* U+00BF */
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* U+00C0 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C1 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C2 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C3 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C4 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C5 */
+	{ .row = 0, .x0 = 3, .x1 = 6 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 4, .x1 = 5 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	{ .row = 3, .x0 = 2, .x1 = 3 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 3, .x1 = 6 },
+	/* U+00C6 */
+	{ .row = 0, .x0 = 2, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 0, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 0, .x1 = 1 },
+	{ .row = 5, .x0 = 2, .x1 = 3 },
+	{ .row = 5, .x0 = 5, .x1 = 6 },
+	{ .row = 6, .x0 = 0, .x1 = 1 },
+	{ .row = 6, .x0 = 2, .x1 = 3 },
+	{ .row = 6, .x0 = 5, .x1 = 6 },
+	/* U+00C7 */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 7 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* U+00C8 */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00C9 */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00CA */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00CB */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00CC */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* U+00CD */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* U+00CE */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* U+00CF */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	/* U+00D0 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 0, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 1, .x1 = 5 },
+	/* U+00D1 */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 4, .x1 = 5 },
+	{ .row = 4, .x0 = 0, .x1 = 6 },
+	/* U+00D2 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* U+00D3 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* U+00D4 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* U+00D5 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 0, .x1 = 1 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* U+00D6 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 5 },
+	/* U+00D7 */
+	{ .row = 0, .x0 = 2, .x1 = 3 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 4, .x1 = 5 },
+	/* U+00D8 */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 4, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* U+00D9 */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* U+00DA */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* U+00DB */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* U+00DC */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 5 },
+	/* U+00DD */
+	{ .row = 0, .x0 = 1, .x1 = 3 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 4, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 1, .x1 = 3 },
+	/* U+00DE */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	/* U+00DF */
+	{ .row = 0, .x0 = 1, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 2, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 5 },
+	/* U+00E0 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E1 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E2 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E3 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E4 */
+	{ .row = 0, .x0 = 0, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E5 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00E6 */
+	{ .row = 0, .x0 = 1, .x1 = 2 },
+	{ .row = 0, .x0 = 4, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	{ .row = 4, .x0 = 1, .x1 = 2 },
+	{ .row = 4, .x0 = 3, .x1 = 4 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	{ .row = 5, .x0 = 1, .x1 = 2 },
+	{ .row = 5, .x0 = 3, .x1 = 4 },
+	{ .row = 5, .x0 = 5, .x1 = 6 },
+	{ .row = 6, .x0 = 2, .x1 = 4 },
+	{ .row = 6, .x0 = 5, .x1 = 6 },
+	/* U+00E7 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 7 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 4, .x1 = 5 },
+	/* U+00E8 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00E9 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00EA */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00EB */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 2 },
+	{ .row = 3, .x0 = 3, .x1 = 4 },
+	{ .row = 3, .x0 = 5, .x1 = 6 },
+	{ .row = 4, .x0 = 2, .x1 = 3 },
+	{ .row = 4, .x0 = 5, .x1 = 6 },
+	/* U+00EC */
+	{ .row = 1, .x0 = 2, .x1 = 6 },
+	/* U+00ED */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 6 },
+	/* U+00EE */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 6 },
+	/* U+00EF */
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 6 },
+	/* U+00F0 */
+	{ .row = 0, .x0 = 3, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 2, .x1 = 3 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 3 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F1 */
+	{ .row = 0, .x0 = 0, .x1 = 6 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 6 },
+	/* U+00F2 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F3 */
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F4 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F5 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 0, .x1 = 1 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F6 */
+	{ .row = 0, .x0 = 0, .x1 = 1 },
+	{ .row = 0, .x0 = 2, .x1 = 5 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00F7 */
+	{ .row = 0, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 3, .x1 = 4 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	/* U+00F8 */
+	{ .row = 0, .x0 = 2, .x1 = 6 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 4, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 3, .x1 = 4 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 5 },
+	/* U+00F9 */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 6 },
+	/* U+00FA */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 6 },
+	/* U+00FB */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 0, .x1 = 1 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 6 },
+	/* U+00FC */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 1, .x1 = 6 },
+	/* U+00FD */
+	{ .row = 0, .x0 = 1, .x1 = 5 },
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 7, .x1 = 8 },
+	{ .row = 3, .x0 = 1, .x1 = 7 },
+	/* U+00FE */
+	{ .row = 0, .x0 = 0, .x1 = 8 },
+	{ .row = 1, .x0 = 1, .x1 = 2 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 1, .x1 = 2 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 3, .x0 = 2, .x1 = 5 },
+	/* U+00FF */
+	{ .row = 0, .x0 = 0, .x1 = 5 },
+	{ .row = 0, .x0 = 7, .x1 = 8 },
+	{ .row = 1, .x0 = 5, .x1 = 6 },
+	{ .row = 1, .x0 = 7, .x1 = 8 },
+	{ .row = 2, .x0 = 0, .x1 = 1 },
+	{ .row = 2, .x0 = 5, .x1 = 6 },
+	{ .row = 2, .x0 = 7, .x1 = 8 },
+	{ .row = 3, .x0 = 1, .x1 = 7 },
+};
+
+/** Glyphs of the built-in font, ASCII first. */
+static const cgifh_glyph_t font_h8_glyphs[224] = {
+	[32] = { /* ' ' */
+		.advance = 3,
+		.spans = &font_h8_spans[0],
+		.span_count = 0,
+		.columns = &font_h8_columns[0],
+		.column_count = 0,
+		.box = { 0, 0, 0, 0 },
+	},
+	[33] = { /* '!' */
+		.advance = 2,
+		.spans = &font_h8_spans[0],
+		.span_count = 5,
+		.columns = &font_h8_columns[0],
+		.column_count = 2,
+		.box = { 0, 0, 1, 6 },
+	},
+	[34] = { /* '"' */
+		.advance = 4,
+		.spans = &font_h8_spans[5],
+		.span_count = 4,
+		.columns = &font_h8_columns[2],
+		.column_count = 2,
+		.box = { 0, 0, 3, 2 },
+	},
+	[35] = { /* '#' */
+		.advance = 6,
+		.spans = &font_h8_spans[9],
+		.span_count = 10,
+		.columns = &font_h8_columns[4],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[36] = { /* '$' */
+		.advance = 6,
+		.spans = &font_h8_spans[19],
+		.span_count = 9,
+		.columns = &font_h8_columns[12],
+		.column_count = 11,
+		.box = { 0, 0, 5, 7 },
+	},
+	[37] = { /* '%' */
+		.advance = 6,
+		.spans = &font_h8_spans[28],
+		.span_count = 10,
+		.columns = &font_h8_columns[23],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[38] = { /* '&' */
+		.advance = 6,
+		.spans = &font_h8_spans[38],
+		.span_count = 11,
+		.columns = &font_h8_columns[32],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[39] = { /* ''' */
+		.advance = 2,
+		.spans = &font_h8_spans[49],
+		.span_count = 2,
+		.columns = &font_h8_columns[44],
+		.column_count = 1,
+		.box = { 0, 0, 1, 2 },
+	},
+	[40] = { /* '(' */
+		.advance = 3,
+		.spans = &font_h8_spans[51],
+		.span_count = 7,
+		.columns = &font_h8_columns[45],
+		.column_count = 3,
+		.box = { 0, 0, 2, 7 },
+	},
+	[41] = { /* ')' */
+		.advance = 3,
+		.spans = &font_h8_spans[58],
+		.span_count = 7,
+		.columns = &font_h8_columns[48],
+		.column_count = 3,
+		.box = { 0, 0, 2, 7 },
+	},
+	[42] = { /* 0x2a */
+		.advance = 6,
+		.spans = &font_h8_spans[65],
+		.span_count = 9,
+		.columns = &font_h8_columns[51],
+		.column_count = 7,
+		.box = { 0, 0, 5, 5 },
+	},
+	[43] = { /* '+' */
+		.advance = 4,
+		.spans = &font_h8_spans[74],
+		.span_count = 3,
+		.columns = &font_h8_columns[58],
+		.column_count = 3,
+		.box = { 0, 2, 3, 5 },
+	},
+	[44] = { /* ',' */
+		.advance = 3,
+		.spans = &font_h8_spans[77],
+		.span_count = 2,
+		.columns = &font_h8_columns[61],
+		.column_count = 2,
+		.box = { 0, 4, 2, 6 },
+	},
+	[45] = { /* '-' */
+		.advance = 4,
+		.spans = &font_h8_spans[79],
+		.span_count = 1,
+		.columns = &font_h8_columns[63],
+		.column_count = 3,
+		.box = { 0, 3, 3, 4 },
+	},
+	[46] = { /* '.' */
+		.advance = 2,
+		.spans = &font_h8_spans[80],
+		.span_count = 1,
+		.columns = &font_h8_columns[66],
+		.column_count = 1,
+		.box = { 0, 5, 1, 6 },
+	},
+	[47] = { /* 0x2f */
+		.advance = 5,
+		.spans = &font_h8_spans[81],
+		.span_count = 6,
+		.columns = &font_h8_columns[67],
+		.column_count = 4,
+		.box = { 0, 0, 4, 6 },
+	},
+	[48] = { /* '0' */
+		.advance = 6,
+		.spans = &font_h8_spans[87],
+		.span_count = 10,
+		.columns = &font_h8_columns[71],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[49] = { /* '1' */
+		.advance = 6,
+		.spans = &font_h8_spans[97],
+		.span_count = 6,
+		.columns = &font_h8_columns[81],
+		.column_count = 4,
+		.box = { 1, 0, 4, 6 },
+	},
+	[50] = { /* '2' */
+		.advance = 6,
+		.spans = &font_h8_spans[103],
+		.span_count = 7,
+		.columns = &font_h8_columns[85],
+		.column_count = 13,
+		.box = { 0, 0, 5, 6 },
+	},
+	[51] = { /* '3' */
+		.advance = 6,
+		.spans = &font_h8_spans[110],
+		.span_count = 8,
+		.columns = &font_h8_columns[98],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[52] = { /* '4' */
+		.advance = 6,
+		.spans = &font_h8_spans[118],
+		.span_count = 8,
+		.columns = &font_h8_columns[110],
+		.column_count = 7,
+		.box = { 0, 0, 5, 6 },
+	},
+	[53] = { /* '5' */
+		.advance = 6,
+		.spans = &font_h8_spans[126],
+		.span_count = 7,
+		.columns = &font_h8_columns[117],
+		.column_count = 13,
+		.box = { 0, 0, 5, 6 },
+	},
+	[54] = { /* '6' */
+		.advance = 6,
+		.spans = &font_h8_spans[133],
+		.span_count = 8,
+		.columns = &font_h8_columns[130],
+		.column_count = 11,
+		.box = { 0, 0, 5, 6 },
+	},
+	[55] = { /* '7' */
+		.advance = 6,
+		.spans = &font_h8_spans[141],
+		.span_count = 6,
+		.columns = &font_h8_columns[141],
+		.column_count = 7,
+		.box = { 0, 0, 5, 6 },
+	},
+	[56] = { /* '8' */
+		.advance = 6,
+		.spans = &font_h8_spans[147],
+		.span_count = 9,
+		.columns = &font_h8_columns[148],
+		.column_count = 13,
+		.box = { 0, 0, 5, 6 },
+	},
+	[57] = { /* '9' */
+		.advance = 6,
+		.spans = &font_h8_spans[156],
+		.span_count = 8,
+		.columns = &font_h8_columns[161],
+		.column_count = 11,
+		.box = { 0, 0, 5, 6 },
+	},
+	[58] = { /* ':' */
+		.advance = 2,
+		.spans = &font_h8_spans[164],
+		.span_count = 2,
+		.columns = &font_h8_columns[172],
+		.column_count = 2,
+		.box = { 0, 2, 1, 6 },
+	},
+	[59] = { /* ';' */
+		.advance = 3,
+		.spans = &font_h8_spans[166],
+		.span_count = 3,
+		.columns = &font_h8_columns[174],
+		.column_count = 3,
+		.box = { 0, 2, 2, 7 },
+	},
+	[60] = { /* '<' */
+		.advance = 5,
+		.spans = &font_h8_spans[169],
+		.span_count = 5,
+		.columns = &font_h8_columns[177],
+		.column_count = 7,
+		.box = { 0, 1, 4, 6 },
+	},
+	[61] = { /* '=' */
+		.advance = 5,
+		.spans = &font_h8_spans[174],
+		.span_count = 2,
+		.columns = &font_h8_columns[184],
+		.column_count = 8,
+		.box = { 0, 2, 4, 5 },
+	},
+	[62] = { /* '>' */
+		.advance = 5,
+		.spans = &font_h8_spans[176],
+		.span_count = 5,
+		.columns = &font_h8_columns[192],
+		.column_count = 7,
+		.box = { 0, 1, 4, 6 },
+	},
+	[63] = { /* '?' */
+		.advance = 6,
+		.spans = &font_h8_spans[181],
+		.span_count = 6,
+		.columns = &font_h8_columns[199],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[64] = { /* '@' */
+		.advance = 6,
+		.spans = &font_h8_spans[187],
+		.span_count = 12,
+		.columns = &font_h8_columns[207],
+		.column_count = 12,
+		.box = { 0, 0, 5, 7 },
+	},
+	[65] = { /* 'A' */
+		.advance = 6,
+		.spans = &font_h8_spans[199],
+		.span_count = 10,
+		.columns = &font_h8_columns[219],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[66] = { /* 'B' */
+		.advance = 6,
+		.spans = &font_h8_spans[209],
+		.span_count = 9,
+		.columns = &font_h8_columns[227],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[67] = { /* 'C' */
+		.advance = 6,
+		.spans = &font_h8_spans[218],
+		.span_count = 8,
+		.columns = &font_h8_columns[239],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[68] = { /* 'D' */
+		.advance = 6,
+		.spans = &font_h8_spans[226],
+		.span_count = 10,
+		.columns = &font_h8_columns[248],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[69] = { /* 'E' */
+		.advance = 6,
+		.spans = &font_h8_spans[236],
+		.span_count = 6,
+		.columns = &font_h8_columns[256],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[70] = { /* 'F' */
+		.advance = 6,
+		.spans = &font_h8_spans[242],
+		.span_count = 6,
+		.columns = &font_h8_columns[268],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[71] = { /* 'G' */
+		.advance = 6,
+		.spans = &font_h8_spans[248],
+		.span_count = 9,
+		.columns = &font_h8_columns[276],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[72] = { /* 'H' */
+		.advance = 6,
+		.spans = &font_h8_spans[257],
+		.span_count = 11,
+		.columns = &font_h8_columns[286],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[73] = { /* 'I' */
+		.advance = 4,
+		.spans = &font_h8_spans[268],
+		.span_count = 6,
+		.columns = &font_h8_columns[291],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[74] = { /* 'J' */
+		.advance = 5,
+		.spans = &font_h8_spans[274],
+		.span_count = 7,
+		.columns = &font_h8_columns[296],
+		.column_count = 6,
+		.box = { 0, 0, 4, 6 },
+	},
+	[75] = { /* 'K' */
+		.advance = 6,
+		.spans = &font_h8_spans[281],
+		.span_count = 11,
+		.columns = &font_h8_columns[302],
+		.column_count = 7,
+		.box = { 0, 0, 5, 6 },
+	},
+	[76] = { /* 'L' */
+		.advance = 5,
+		.spans = &font_h8_spans[292],
+		.span_count = 6,
+		.columns = &font_h8_columns[309],
+		.column_count = 4,
+		.box = { 0, 0, 4, 6 },
+	},
+	[77] = { /* 'M' */
+		.advance = 8,
+		.spans = &font_h8_spans[298],
+		.span_count = 16,
+		.columns = &font_h8_columns[313],
+		.column_count = 7,
+		.box = { 0, 0, 7, 6 },
+	},
+	[78] = { /* 'N' */
+		.advance = 6,
+		.spans = &font_h8_spans[314],
+		.span_count = 13,
+		.columns = &font_h8_columns[320],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[79] = { /* 'O' */
+		.advance = 6,
+		.spans = &font_h8_spans[327],
+		.span_count = 10,
+		.columns = &font_h8_columns[325],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[80] = { /* 'P' */
+		.advance = 6,
+		.spans = &font_h8_spans[337],
+		.span_count = 7,
+		.columns = &font_h8_columns[333],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[81] = { /* 'Q' */
+		.advance = 6,
+		.spans = &font_h8_spans[344],
+		.span_count = 10,
+		.columns = &font_h8_columns[341],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[82] = { /* 'R' */
+		.advance = 6,
+		.spans = &font_h8_spans[354],
+		.span_count = 10,
+		.columns = &font_h8_columns[350],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[83] = { /* 'S' */
+		.advance = 7,
+		.spans = &font_h8_spans[364],
+		.span_count = 8,
+		.columns = &font_h8_columns[358],
+		.column_count = 16,
+		.box = { 0, 0, 6, 6 },
+	},
+	[84] = { /* 'T' */
+		.advance = 6,
+		.spans = &font_h8_spans[372],
+		.span_count = 6,
+		.columns = &font_h8_columns[374],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[85] = { /* 'U' */
+		.advance = 6,
+		.spans = &font_h8_spans[378],
+		.span_count = 11,
+		.columns = &font_h8_columns[379],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[86] = { /* 'V' */
+		.advance = 6,
+		.spans = &font_h8_spans[389],
+		.span_count = 11,
+		.columns = &font_h8_columns[384],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[87] = { /* 'W' */
+		.advance = 8,
+		.spans = &font_h8_spans[400],
+		.span_count = 15,
+		.columns = &font_h8_columns[389],
+		.column_count = 7,
+		.box = { 0, 0, 7, 6 },
+	},
+	[88] = { /* 'X' */
+		.advance = 6,
+		.spans = &font_h8_spans[415],
+		.span_count = 10,
+		.columns = &font_h8_columns[396],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[89] = { /* 'Y' */
+		.advance = 6,
+		.spans = &font_h8_spans[425],
+		.span_count = 9,
+		.columns = &font_h8_columns[405],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[90] = { /* 'Z' */
+		.advance = 5,
+		.spans = &font_h8_spans[434],
+		.span_count = 6,
+		.columns = &font_h8_columns[410],
+		.column_count = 10,
+		.box = { 0, 0, 4, 6 },
+	},
+	[91] = { /* '[' */
+		.advance = 3,
+		.spans = &font_h8_spans[440],
+		.span_count = 7,
+		.columns = &font_h8_columns[420],
+		.column_count = 3,
+		.box = { 0, 0, 2, 7 },
+	},
+	[92] = { /* 0x5c */
+		.advance = 5,
+		.spans = &font_h8_spans[447],
+		.span_count = 6,
+		.columns = &font_h8_columns[423],
+		.column_count = 4,
+		.box = { 0, 0, 4, 6 },
+	},
+	[93] = { /* ']' */
+		.advance = 3,
+		.spans = &font_h8_spans[453],
+		.span_count = 7,
+		.columns = &font_h8_columns[427],
+		.column_count = 3,
+		.box = { 0, 0, 2, 7 },
+	},
+	[94] = { /* '^' */
+		.advance = 6,
+		.spans = &font_h8_spans[460],
+		.span_count = 5,
+		.columns = &font_h8_columns[430],
+		.column_count = 5,
+		.box = { 0, 0, 5, 3 },
+	},
+	[95] = { /* '_' */
+		.advance = 6,
+		.spans = &font_h8_spans[465],
+		.span_count = 1,
+		.columns = &font_h8_columns[435],
+		.column_count = 5,
+		.box = { 0, 7, 5, 8 },
+	},
+	[96] = { /* '`' */
+		.advance = 3,
+		.spans = &font_h8_spans[466],
+		.span_count = 2,
+		.columns = &font_h8_columns[440],
+		.column_count = 2,
+		.box = { 0, 0, 2, 2 },
+	},
+	[97] = { /* 'a' */
+		.advance = 5,
+		.spans = &font_h8_spans[468],
+		.span_count = 6,
+		.columns = &font_h8_columns[442],
+		.column_count = 9,
+		.box = { 0, 1, 4, 6 },
+	},
+	[98] = { /* 'b' */
+		.advance = 6,
+		.spans = &font_h8_spans[474],
+		.span_count = 9,
+		.columns = &font_h8_columns[451],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[99] = { /* 'c' */
+		.advance = 6,
+		.spans = &font_h8_spans[483],
+		.span_count = 7,
+		.columns = &font_h8_columns[459],
+		.column_count = 9,
+		.box = { 0, 1, 5, 6 },
+	},
+	[100] = { /* 'd' */
+		.advance = 6,
+		.spans = &font_h8_spans[490],
+		.span_count = 9,
+		.columns = &font_h8_columns[468],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[101] = { /* 'e' */
+		.advance = 6,
+		.spans = &font_h8_spans[499],
+		.span_count = 6,
+		.columns = &font_h8_columns[476],
+		.column_count = 12,
+		.box = { 0, 1, 5, 6 },
+	},
+	[102] = { /* 'f' */
+		.advance = 4,
+		.spans = &font_h8_spans[505],
+		.span_count = 6,
+		.columns = &font_h8_columns[488],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[103] = { /* 'g' */
+		.advance = 5,
+		.spans = &font_h8_spans[511],
+		.span_count = 10,
+		.columns = &font_h8_columns[493],
+		.column_count = 9,
+		.box = { 0, 1, 4, 8 },
+	},
+	[104] = { /* 'h' */
+		.advance = 5,
+		.spans = &font_h8_spans[521],
+		.span_count = 10,
+		.columns = &font_h8_columns[502],
+		.column_count = 4,
+		.box = { 0, 0, 4, 6 },
+	},
+	[105] = { /* 'i' */
+		.advance = 2,
+		.spans = &font_h8_spans[531],
+		.span_count = 5,
+		.columns = &font_h8_columns[506],
+		.column_count = 2,
+		.box = { 0, 0, 1, 6 },
+	},
+	[106] = { /* 'j' */
+		.advance = 3,
+		.spans = &font_h8_spans[536],
+		.span_count = 7,
+		.columns = &font_h8_columns[508],
+		.column_count = 3,
+		.box = { 0, 0, 2, 8 },
+	},
+	[107] = { /* 'k' */
+		.advance = 5,
+		.spans = &font_h8_spans[543],
+		.span_count = 10,
+		.columns = &font_h8_columns[511],
+		.column_count = 6,
+		.box = { 0, 0, 4, 6 },
+	},
+	[108] = { /* 'l' */
+		.advance = 2,
+		.spans = &font_h8_spans[553],
+		.span_count = 6,
+		.columns = &font_h8_columns[517],
+		.column_count = 1,
+		.box = { 0, 0, 1, 6 },
+	},
+	[109] = { /* 'm' */
+		.advance = 6,
+		.spans = &font_h8_spans[559],
+		.span_count = 11,
+		.columns = &font_h8_columns[518],
+		.column_count = 5,
+		.box = { 0, 1, 5, 6 },
+	},
+	[110] = { /* 'n' */
+		.advance = 5,
+		.spans = &font_h8_spans[570],
+		.span_count = 9,
+		.columns = &font_h8_columns[523],
+		.column_count = 4,
+		.box = { 0, 1, 4, 6 },
+	},
+	[111] = { /* 'o' */
+		.advance = 5,
+		.spans = &font_h8_spans[579],
+		.span_count = 8,
+		.columns = &font_h8_columns[527],
+		.column_count = 6,
+		.box = { 0, 1, 4, 6 },
+	},
+	[112] = { /* 'p' */
+		.advance = 5,
+		.spans = &font_h8_spans[587],
+		.span_count = 10,
+		.columns = &font_h8_columns[533],
+		.column_count = 6,
+		.box = { 0, 1, 4, 8 },
+	},
+	[113] = { /* 'q' */
+		.advance = 5,
+		.spans = &font_h8_spans[597],
+		.span_count = 10,
+		.columns = &font_h8_columns[539],
+		.column_count = 6,
+		.box = { 0, 1, 4, 8 },
+	},
+	[114] = { /* 'r' */
+		.advance = 5,
+		.spans = &font_h8_spans[607],
+		.span_count = 6,
+		.columns = &font_h8_columns[545],
+		.column_count = 4,
+		.box = { 0, 1, 4, 6 },
+	},
+	[115] = { /* 's' */
+		.advance = 6,
+		.spans = &font_h8_spans[613],
+		.span_count = 5,
+		.columns = &font_h8_columns[549],
+		.column_count = 13,
+		.box = { 0, 1, 5, 6 },
+	},
+	[116] = { /* 't' */
+		.advance = 4,
+		.spans = &font_h8_spans[618],
+		.span_count = 6,
+		.columns = &font_h8_columns[562],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[117] = { /* 'u' */
+		.advance = 5,
+		.spans = &font_h8_spans[624],
+		.span_count = 9,
+		.columns = &font_h8_columns[567],
+		.column_count = 4,
+		.box = { 0, 1, 4, 6 },
+	},
+	[118] = { /* 'v' */
+		.advance = 6,
+		.spans = &font_h8_spans[633],
+		.span_count = 9,
+		.columns = &font_h8_columns[571],
+		.column_count = 5,
+		.box = { 0, 1, 5, 6 },
+	},
+	[119] = { /* 'w' */
+		.advance = 6,
+		.spans = &font_h8_spans[642],
+		.span_count = 12,
+		.columns = &font_h8_columns[576],
+		.column_count = 5,
+		.box = { 0, 1, 5, 6 },
+	},
+	[120] = { /* 'x' */
+		.advance = 6,
+		.spans = &font_h8_spans[654],
+		.span_count = 9,
+		.columns = &font_h8_columns[581],
+		.column_count = 9,
+		.box = { 0, 1, 5, 6 },
+	},
+	[121] = { /* 'y' */
+		.advance = 5,
+		.spans = &font_h8_spans[663],
+		.span_count = 11,
+		.columns = &font_h8_columns[590],
+		.column_count = 7,
+		.box = { 0, 1, 4, 8 },
+	},
+	[122] = { /* 'z' */
+		.advance = 5,
+		.spans = &font_h8_spans[674],
+		.span_count = 5,
+		.columns = &font_h8_columns[597],
+		.column_count = 10,
+		.box = { 0, 1, 4, 6 },
+	},
+	[123] = { /* '{' */
+		.advance = 4,
+		.spans = &font_h8_spans[679],
+		.span_count = 7,
+		.columns = &font_h8_columns[607],
+		.column_count = 4,
+		.box = { 0, 0, 3, 7 },
+	},
+	[124] = { /* '|' */
+		.advance = 2,
+		.spans = &font_h8_spans[686],
+		.span_count = 7,
+		.columns = &font_h8_columns[611],
+		.column_count = 1,
+		.box = { 0, 0, 1, 7 },
+	},
+	[125] = { /* '}' */
+		.advance = 4,
+		.spans = &font_h8_spans[693],
+		.span_count = 7,
+		.columns = &font_h8_columns[612],
+		.column_count = 4,
+		.box = { 0, 0, 3, 7 },
+	},
+	[126] = { /* '~' */
+		.advance = 6,
+		.spans = &font_h8_spans[700],
+		.span_count = 4,
+		.columns = &font_h8_columns[616],
+		.column_count = 5,
+		.box = { 0, 2, 5, 4 },
+	},
+	[128] = { /* U+00A0 */
+		.advance = 3,
+		.spans = &font_h8_spans[704],
+		.span_count = 0,
+		.columns = &font_h8_columns[621],
+		.column_count = 0,
+		.box = { 0, 0, 0, 0 },
+	},
+	[129] = { /* U+00A1 */
+		.advance = 2,
+		.spans = &font_h8_spans[704],
+		.span_count = 5,
+		.columns = &font_h8_columns[621],
+		.column_count = 2,
+		.box = { 0, 0, 1, 6 },
+	},
+	[130] = { /* U+00A2 */
+		.advance = 5,
+		.spans = &font_h8_spans[709],
+		.span_count = 8,
+		.columns = &font_h8_columns[623],
+		.column_count = 6,
+		.box = { 0, 0, 4, 6 },
+	},
+	[131] = { /* U+00A3 */
+		.advance = 6,
+		.spans = &font_h8_spans[717],
+		.span_count = 7,
+		.columns = &font_h8_columns[629],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[132] = { /* U+00A4 */
+		.advance = 6,
+		.spans = &font_h8_spans[724],
+		.span_count = 8,
+		.columns = &font_h8_columns[639],
+		.column_count = 8,
+		.box = { 0, 1, 5, 6 },
+	},
+	[133] = { /* U+00A5 */
+		.advance = 6,
+		.spans = &font_h8_spans[732],
+		.span_count = 8,
+		.columns = &font_h8_columns[647],
+		.column_count = 11,
+		.box = { 0, 0, 5, 6 },
+	},
+	[134] = { /* U+00A6 */
+		.advance = 2,
+		.spans = &font_h8_spans[740],
+		.span_count = 6,
+		.columns = &font_h8_columns[658],
+		.column_count = 2,
+		.box = { 0, 0, 1, 7 },
+	},
+	[135] = { /* U+00A7 */
+		.advance = 5,
+		.spans = &font_h8_spans[746],
+		.span_count = 8,
+		.columns = &font_h8_columns[660],
+		.column_count = 14,
+		.box = { 0, 0, 4, 7 },
+	},
+	[136] = { /* U+00A8 */
+		.advance = 4,
+		.spans = &font_h8_spans[754],
+		.span_count = 2,
+		.columns = &font_h8_columns[674],
+		.column_count = 2,
+		.box = { 0, 0, 3, 1 },
+	},
+	[137] = { /* U+00A9 */
+		.advance = 8,
+		.spans = &font_h8_spans[756],
+		.span_count = 15,
+		.columns = &font_h8_columns[676],
+		.column_count = 17,
+		.box = { 0, 0, 7, 7 },
+	},
+	[138] = { /* U+00AA */
+		.advance = 4,
+		.spans = &font_h8_spans[771],
+		.span_count = 5,
+		.columns = &font_h8_columns[693],
+		.column_count = 7,
+		.box = { 0, 0, 3, 5 },
+	},
+	[139] = { /* U+00AB */
+		.advance = 5,
+		.spans = &font_h8_spans[776],
+		.span_count = 6,
+		.columns = &font_h8_columns[700],
+		.column_count = 6,
+		.box = { 0, 2, 4, 5 },
+	},
+	[140] = { /* U+00AC */
+		.advance = 5,
+		.spans = &font_h8_spans[782],
+		.span_count = 2,
+		.columns = &font_h8_columns[706],
+		.column_count = 4,
+		.box = { 0, 2, 4, 4 },
+	},
+	[141] = { /* U+00AD */
+		.advance = 4,
+		.spans = &font_h8_spans[784],
+		.span_count = 1,
+		.columns = &font_h8_columns[710],
+		.column_count = 3,
+		.box = { 0, 3, 3, 4 },
+	},
+	[142] = { /* U+00AE */
+		.advance = 8,
+		.spans = &font_h8_spans[785],
+		.span_count = 18,
+		.columns = &font_h8_columns[713],
+		.column_count = 15,
+		.box = { 0, 0, 7, 7 },
+	},
+	[143] = { /* U+00AF */
+		.advance = 5,
+		.spans = &font_h8_spans[803],
+		.span_count = 1,
+		.columns = &font_h8_columns[728],
+		.column_count = 4,
+		.box = { 0, 0, 4, 1 },
+	},
+	[144] = { /* U+00B0 */
+		.advance = 4,
+		.spans = &font_h8_spans[804],
+		.span_count = 4,
+		.columns = &font_h8_columns[732],
+		.column_count = 4,
+		.box = { 0, 0, 3, 3 },
+	},
+	[145] = { /* U+00B1 */
+		.advance = 4,
+		.spans = &font_h8_spans[808],
+		.span_count = 4,
+		.columns = &font_h8_columns[736],
+		.column_count = 6,
+		.box = { 0, 1, 3, 6 },
+	},
+	[146] = { /* U+00B2 */
+		.advance = 4,
+		.spans = &font_h8_spans[812],
+		.span_count = 4,
+		.columns = &font_h8_columns[742],
+		.column_count = 6,
+		.box = { 0, 0, 3, 4 },
+	},
+	[147] = { /* U+00B3 */
+		.advance = 4,
+		.spans = &font_h8_spans[816],
+		.span_count = 4,
+		.columns = &font_h8_columns[748],
+		.column_count = 6,
+		.box = { 0, 0, 3, 4 },
+	},
+	[148] = { /* U+00B4 */
+		.advance = 3,
+		.spans = &font_h8_spans[820],
+		.span_count = 2,
+		.columns = &font_h8_columns[754],
+		.column_count = 2,
+		.box = { 0, 0, 2, 2 },
+	},
+	[149] = { /* U+00B5 */
+		.advance = 5,
+		.spans = &font_h8_spans[822],
+		.span_count = 10,
+		.columns = &font_h8_columns[756],
+		.column_count = 4,
+		.box = { 0, 1, 4, 7 },
+	},
+	[150] = { /* U+00B6 */
+		.advance = 6,
+		.spans = &font_h8_spans[832],
+		.span_count = 11,
+		.columns = &font_h8_columns[760],
+		.column_count = 5,
+		.box = { 0, 0, 5, 6 },
+	},
+	[151] = { /* U+00B7 */
+		.advance = 2,
+		.spans = &font_h8_spans[843],
+		.span_count = 1,
+		.columns = &font_h8_columns[765],
+		.column_count = 1,
+		.box = { 0, 3, 1, 4 },
+	},
+	[152] = { /* U+00B8 */
+		.advance = 3,
+		.spans = &font_h8_spans[844],
+		.span_count = 2,
+		.columns = &font_h8_columns[766],
+		.column_count = 2,
+		.box = { 0, 6, 2, 8 },
+	},
+	[153] = { /* U+00B9 */
+		.advance = 4,
+		.spans = &font_h8_spans[846],
+		.span_count = 4,
+		.columns = &font_h8_columns[768],
+		.column_count = 4,
+		.box = { 0, 0, 3, 4 },
+	},
+	[154] = { /* U+00BA */
+		.advance = 4,
+		.spans = &font_h8_spans[850],
+		.span_count = 5,
+		.columns = &font_h8_columns[772],
+		.column_count = 7,
+		.box = { 0, 0, 3, 5 },
+	},
+	[155] = { /* U+00BB */
+		.advance = 5,
+		.spans = &font_h8_spans[855],
+		.span_count = 6,
+		.columns = &font_h8_columns[779],
+		.column_count = 6,
+		.box = { 0, 2, 4, 5 },
+	},
+	[156] = { /* U+00BC */
+		.advance = 7,
+		.spans = &font_h8_spans[861],
+		.span_count = 12,
+		.columns = &font_h8_columns[785],
+		.column_count = 9,
+		.box = { 0, 0, 6, 6 },
+	},
+	[157] = { /* U+00BD */
+		.advance = 6,
+		.spans = &font_h8_spans[873],
+		.span_count = 12,
+		.columns = &font_h8_columns[794],
+		.column_count = 10,
+		.box = { 0, 0, 5, 7 },
+	},
+	[158] = { /* U+00BE */
+		.advance = 7,
+		.spans = &font_h8_spans[885],
+		.span_count = 11,
+		.columns = &font_h8_columns[804],
+		.column_count = 10,
+		.box = { 0, 0, 6, 6 },
+	},
+	[159] = { /* U+00BF */
+		.advance = 6,
+		.spans = &font_h8_spans[896],
+		.span_count = 6,
+		.columns = &font_h8_columns[814],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[160] = { /* U+00C0 */
+		.advance = 6,
+		.spans = &font_h8_spans[902],
+		.span_count = 9,
+		.columns = &font_h8_columns[822],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[161] = { /* U+00C1 */
+		.advance = 6,
+		.spans = &font_h8_spans[911],
+		.span_count = 9,
+		.columns = &font_h8_columns[831],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[162] = { /* U+00C2 */
+		.advance = 6,
+		.spans = &font_h8_spans[920],
+		.span_count = 9,
+		.columns = &font_h8_columns[840],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[163] = { /* U+00C3 */
+		.advance = 6,
+		.spans = &font_h8_spans[929],
+		.span_count = 10,
+		.columns = &font_h8_columns[850],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[164] = { /* U+00C4 */
+		.advance = 6,
+		.spans = &font_h8_spans[939],
+		.span_count = 10,
+		.columns = &font_h8_columns[860],
+		.column_count = 10,
+		.box = { 0, 0, 5, 6 },
+	},
+	[165] = { /* U+00C5 */
+		.advance = 6,
+		.spans = &font_h8_spans[949],
+		.span_count = 9,
+		.columns = &font_h8_columns[870],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[166] = { /* U+00C6 */
+		.advance = 8,
+		.spans = &font_h8_spans[958],
+		.span_count = 10,
+		.columns = &font_h8_columns[878],
+		.column_count = 15,
+		.box = { 0, 0, 7, 6 },
+	},
+	[167] = { /* U+00C7 */
+		.advance = 6,
+		.spans = &font_h8_spans[968],
+		.span_count = 10,
+		.columns = &font_h8_columns[893],
+		.column_count = 10,
+		.box = { 0, 0, 5, 8 },
+	},
+	[168] = { /* U+00C8 */
+		.advance = 6,
+		.spans = &font_h8_spans[978],
+		.span_count = 6,
+		.columns = &font_h8_columns[903],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[169] = { /* U+00C9 */
+		.advance = 6,
+		.spans = &font_h8_spans[984],
+		.span_count = 6,
+		.columns = &font_h8_columns[915],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[170] = { /* U+00CA */
+		.advance = 6,
+		.spans = &font_h8_spans[990],
+		.span_count = 6,
+		.columns = &font_h8_columns[927],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[171] = { /* U+00CB */
+		.advance = 6,
+		.spans = &font_h8_spans[996],
+		.span_count = 7,
+		.columns = &font_h8_columns[939],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[172] = { /* U+00CC */
+		.advance = 4,
+		.spans = &font_h8_spans[1003],
+		.span_count = 6,
+		.columns = &font_h8_columns[951],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[173] = { /* U+00CD */
+		.advance = 4,
+		.spans = &font_h8_spans[1009],
+		.span_count = 6,
+		.columns = &font_h8_columns[956],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[174] = { /* U+00CE */
+		.advance = 4,
+		.spans = &font_h8_spans[1015],
+		.span_count = 6,
+		.columns = &font_h8_columns[961],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[175] = { /* U+00CF */
+		.advance = 4,
+		.spans = &font_h8_spans[1021],
+		.span_count = 7,
+		.columns = &font_h8_columns[966],
+		.column_count = 5,
+		.box = { 0, 0, 3, 6 },
+	},
+	[176] = { /* U+00D0 */
+		.advance = 7,
+		.spans = &font_h8_spans[1028],
+		.span_count = 10,
+		.columns = &font_h8_columns[971],
+		.column_count = 10,
+		.box = { 0, 0, 6, 6 },
+	},
+	[177] = { /* U+00D1 */
+		.advance = 6,
+		.spans = &font_h8_spans[1038],
+		.span_count = 13,
+		.columns = &font_h8_columns[981],
+		.column_count = 7,
+		.box = { 0, 0, 5, 6 },
+	},
+	[178] = { /* U+00D2 */
+		.advance = 6,
+		.spans = &font_h8_spans[1051],
+		.span_count = 9,
+		.columns = &font_h8_columns[988],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[179] = { /* U+00D3 */
+		.advance = 6,
+		.spans = &font_h8_spans[1060],
+		.span_count = 9,
+		.columns = &font_h8_columns[996],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[180] = { /* U+00D4 */
+		.advance = 6,
+		.spans = &font_h8_spans[1069],
+		.span_count = 9,
+		.columns = &font_h8_columns[1004],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[181] = { /* U+00D5 */
+		.advance = 6,
+		.spans = &font_h8_spans[1078],
+		.span_count = 10,
+		.columns = &font_h8_columns[1012],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[182] = { /* U+00D6 */
+		.advance = 6,
+		.spans = &font_h8_spans[1088],
+		.span_count = 10,
+		.columns = &font_h8_columns[1021],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[183] = { /* U+00D7 */
+		.advance = 4,
+		.spans = &font_h8_spans[1098],
+		.span_count = 5,
+		.columns = &font_h8_columns[1029],
+		.column_count = 5,
+		.box = { 0, 2, 3, 5 },
+	},
+	[184] = { /* U+00D8 */
+		.advance = 6,
+		.spans = &font_h8_spans[1103],
+		.span_count = 12,
+		.columns = &font_h8_columns[1034],
+		.column_count = 9,
+		.box = { 0, 0, 5, 6 },
+	},
+	[185] = { /* U+00D9 */
+		.advance = 6,
+		.spans = &font_h8_spans[1115],
+		.span_count = 10,
+		.columns = &font_h8_columns[1043],
+		.column_count = 6,
+		.box = { 0, 0, 5, 6 },
+	},
+	[186] = { /* U+00DA */
+		.advance = 6,
+		.spans = &font_h8_spans[1125],
+		.span_count = 10,
+		.columns = &font_h8_columns[1049],
+		.column_count = 6,
+		.box = { 0, 0, 5, 6 },
+	},
+	[187] = { /* U+00DB */
+		.advance = 6,
+		.spans = &font_h8_spans[1135],
+		.span_count = 10,
+		.columns = &font_h8_columns[1055],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[188] = { /* U+00DC */
+		.advance = 6,
+		.spans = &font_h8_spans[1145],
+		.span_count = 11,
+		.columns = &font_h8_columns[1063],
+		.column_count = 7,
+		.box = { 0, 0, 5, 6 },
+	},
+	[189] = { /* U+00DD */
+		.advance = 6,
+		.spans = &font_h8_spans[1156],
+		.span_count = 9,
+		.columns = &font_h8_columns[1070],
+		.column_count = 6,
+		.box = { 0, 0, 5, 6 },
+	},
+	[190] = { /* U+00DE */
+		.advance = 6,
+		.spans = &font_h8_spans[1165],
+		.span_count = 7,
+		.columns = &font_h8_columns[1076],
+		.column_count = 8,
+		.box = { 0, 0, 5, 6 },
+	},
+	[191] = { /* U+00DF */
+		.advance = 5,
+		.spans = &font_h8_spans[1172],
+		.span_count = 11,
+		.columns = &font_h8_columns[1084],
+		.column_count = 7,
+		.box = { 0, 0, 4, 6 },
+	},
+	[192] = { /* U+00E0 */
+		.advance = 5,
+		.spans = &font_h8_spans[1183],
+		.span_count = 7,
+		.columns = &font_h8_columns[1091],
+		.column_count = 9,
+		.box = { 0, 0, 4, 6 },
+	},
+	[193] = { /* U+00E1 */
+		.advance = 5,
+		.spans = &font_h8_spans[1190],
+		.span_count = 7,
+		.columns = &font_h8_columns[1100],
+		.column_count = 9,
+		.box = { 0, 0, 4, 6 },
+	},
+	[194] = { /* U+00E2 */
+		.advance = 5,
+		.spans = &font_h8_spans[1197],
+		.span_count = 7,
+		.columns = &font_h8_columns[1109],
+		.column_count = 9,
+		.box = { 0, 0, 4, 6 },
+	},
+	[195] = { /* U+00E3 */
+		.advance = 5,
+		.spans = &font_h8_spans[1204],
+		.span_count = 8,
+		.columns = &font_h8_columns[1118],
+		.column_count = 10,
+		.box = { 0, 0, 4, 6 },
+	},
+	[196] = { /* U+00E4 */
+		.advance = 5,
+		.spans = &font_h8_spans[1212],
+		.span_count = 8,
+		.columns = &font_h8_columns[1128],
+		.column_count = 9,
+		.box = { 0, 0, 4, 6 },
+	},
+	[197] = { /* U+00E5 */
+		.advance = 5,
+		.spans = &font_h8_spans[1220],
+		.span_count = 7,
+		.columns = &font_h8_columns[1137],
+		.column_count = 9,
+		.box = { 0, 0, 4, 6 },
+	},
+	[198] = { /* U+00E6 */
+		.advance = 8,
+		.spans = &font_h8_spans[1227],
+		.span_count = 8,
+		.columns = &font_h8_columns[1146],
+		.column_count = 17,
+		.box = { 0, 1, 7, 6 },
+	},
+	[199] = { /* U+00E7 */
+		.advance = 6,
+		.spans = &font_h8_spans[1235],
+		.span_count = 9,
+		.columns = &font_h8_columns[1163],
+		.column_count = 10,
+		.box = { 0, 1, 5, 8 },
+	},
+	[200] = { /* U+00E8 */
+		.advance = 6,
+		.spans = &font_h8_spans[1244],
+		.span_count = 7,
+		.columns = &font_h8_columns[1173],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[201] = { /* U+00E9 */
+		.advance = 6,
+		.spans = &font_h8_spans[1251],
+		.span_count = 7,
+		.columns = &font_h8_columns[1185],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[202] = { /* U+00EA */
+		.advance = 6,
+		.spans = &font_h8_spans[1258],
+		.span_count = 7,
+		.columns = &font_h8_columns[1197],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[203] = { /* U+00EB */
+		.advance = 6,
+		.spans = &font_h8_spans[1265],
+		.span_count = 8,
+		.columns = &font_h8_columns[1209],
+		.column_count = 12,
+		.box = { 0, 0, 5, 6 },
+	},
+	[204] = { /* U+00EC */
+		.advance = 4,
+		.spans = &font_h8_spans[1273],
+		.span_count = 4,
+		.columns = &font_h8_columns[1221],
+		.column_count = 1,
+		.box = { 1, 2, 2, 6 },
+	},
+	[205] = { /* U+00ED */
+		.advance = 4,
+		.spans = &font_h8_spans[1277],
+		.span_count = 5,
+		.columns = &font_h8_columns[1222],
+		.column_count = 2,
+		.box = { 1, 0, 2, 6 },
+	},
+	[206] = { /* U+00EE */
+		.advance = 4,
+		.spans = &font_h8_spans[1282],
+		.span_count = 5,
+		.columns = &font_h8_columns[1224],
+		.column_count = 3,
+		.box = { 0, 0, 2, 6 },
+	},
+	[207] = { /* U+00EF */
+		.advance = 4,
+		.spans = &font_h8_spans[1287],
+		.span_count = 5,
+		.columns = &font_h8_columns[1227],
+		.column_count = 2,
+		.box = { 1, 0, 2, 6 },
+	},
+	[208] = { /* U+00F0 */
+		.advance = 5,
+		.spans = &font_h8_spans[1292],
+		.span_count = 9,
+		.columns = &font_h8_columns[1229],
+		.column_count = 8,
+		.box = { 0, 0, 4, 6 },
+	},
+	[209] = { /* U+00F1 */
+		.advance = 5,
+		.spans = &font_h8_spans[1301],
+		.span_count = 11,
+		.columns = &font_h8_columns[1237],
+		.column_count = 5,
+		.box = { 0, 0, 4, 6 },
+	},
+	[210] = { /* U+00F2 */
+		.advance = 5,
+		.spans = &font_h8_spans[1312],
+		.span_count = 9,
+		.columns = &font_h8_columns[1242],
+		.column_count = 7,
+		.box = { 0, 0, 4, 6 },
+	},
+	[211] = { /* U+00F3 */
+		.advance = 5,
+		.spans = &font_h8_spans[1321],
+		.span_count = 9,
+		.columns = &font_h8_columns[1249],
+		.column_count = 6,
+		.box = { 0, 0, 4, 6 },
+	},
+	[212] = { /* U+00F4 */
+		.advance = 5,
+		.spans = &font_h8_spans[1330],
+		.span_count = 9,
+		.columns = &font_h8_columns[1255],
+		.column_count = 7,
+		.box = { 0, 0, 4, 6 },
+	},
+	[213] = { /* U+00F5 */
+		.advance = 5,
+		.spans = &font_h8_spans[1339],
+		.span_count = 10,
+		.columns = &font_h8_columns[1262],
+		.column_count = 8,
+		.box = { 0, 0, 4, 6 },
+	},
+	[214] = { /* U+00F6 */
+		.advance = 5,
+		.spans = &font_h8_spans[1349],
+		.span_count = 10,
+		.columns = &font_h8_columns[1270],
+		.column_count = 7,
+		.box = { 0, 0, 4, 6 },
+	},
+	[215] = { /* U+00F7 */
+		.advance = 4,
+		.spans = &font_h8_spans[1359],
+		.span_count = 3,
+		.columns = &font_h8_columns[1277],
+		.column_count = 5,
+		.box = { 0, 1, 3, 6 },
+	},
+	[216] = { /* U+00F8 */
+		.advance = 5,
+		.spans = &font_h8_spans[1362],
+		.span_count = 8,
+		.columns = &font_h8_columns[1282],
+		.column_count = 7,
+		.box = { 0, 1, 4, 6 },
+	},
+	[217] = { /* U+00F9 */
+		.advance = 5,
+		.spans = &font_h8_spans[1370],
+		.span_count = 10,
+		.columns = &font_h8_columns[1289],
+		.column_count = 4,
+		.box = { 0, 0, 4, 6 },
+	},
+	[218] = { /* U+00FA */
+		.advance = 5,
+		.spans = &font_h8_spans[1380],
+		.span_count = 10,
+		.columns = &font_h8_columns[1293],
+		.column_count = 5,
+		.box = { 0, 0, 4, 6 },
+	},
+	[219] = { /* U+00FB */
+		.advance = 5,
+		.spans = &font_h8_spans[1390],
+		.span_count = 10,
+		.columns = &font_h8_columns[1298],
+		.column_count = 6,
+		.box = { 0, 0, 4, 6 },
+	},
+	[220] = { /* U+00FC */
+		.advance = 5,
+		.spans = &font_h8_spans[1400],
+		.span_count = 11,
+		.columns = &font_h8_columns[1304],
+		.column_count = 5,
+		.box = { 0, 0, 4, 6 },
+	},
+	[221] = { /* U+00FD */
+		.advance = 5,
+		.spans = &font_h8_spans[1411],
+		.span_count = 12,
+		.columns = &font_h8_columns[1309],
+		.column_count = 8,
+		.box = { 0, 0, 4, 8 },
+	},
+	[222] = { /* U+00FE */
+		.advance = 5,
+		.spans = &font_h8_spans[1423],
+		.span_count = 11,
+		.columns = &font_h8_columns[1317],
+		.column_count = 6,
+		.box = { 0, 0, 4, 8 },
+	},
+	[223] = { /* U+00FF */
+		.advance = 5,
+		.spans = &font_h8_spans[1434],
+		.span_count = 13,
+		.columns = &font_h8_columns[1323],
+		.column_count = 8,
+		.box = { 0, 0, 4, 8 },
+	},
+};
+
+/** First level of the built-in font's glyph map. */
+static const uint16_t font_h8_blocks[4] = {
+	0, 0, 1, 2,
+};
+
+/** Second level of the built-in font's glyph map. */
+static const uint16_t font_h8_map[3][64] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		128, 129, 130, 131, 132, 133, 134, 135,
+		136, 137, 138, 139, 140, 141, 142, 143,
+		144, 145, 146, 147, 148, 149, 150, 151,
+		152, 153, 154, 155, 156, 157, 158, 159,
+	},
+	{
+		160, 161, 162, 163, 164, 165, 166, 167,
+		168, 169, 170, 171, 172, 173, 174, 175,
+		176, 177, 178, 179, 180, 181, 182, 183,
+		184, 185, 186, 187, 188, 189, 190, 191,
+		192, 193, 194, 195, 196, 197, 198, 199,
+		200, 201, 202, 203, 204, 205, 206, 207,
+		208, 209, 210, 211, 212, 213, 214, 215,
+		216, 217, 218, 219, 220, 221, 222, 223,
+	},
+};
+
+/* Internal data, documented in font.h */
+const cgifh_font_t cgifh_font_builtin = {
+	.width = 8,
+	.height = 8,
+	.overhang = 0,
+	.glyph_count = 224,
+	.glyphs = font_h8_glyphs,
+	.block_count = 4,
+	.blocks = font_h8_blocks,
+	.map = font_h8_map,
+};
@@ -13,6 +13,33 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+/**
+ * \file CGIF Helper API.
+ *
+ * The library has no global mutable state, so its functions may be called
+ * from any number of threads at once, as long as no object is used by two
+ * threads at the same time. Images, render contexts, text caches and the
+ * layouts they return, and cached layers, belong to one thread at a time.
+ * Fonts and glyph atlases are not modified after they are created, so once
+ * created they may be shared by any number of threads.
+ *
+ * Threads rendering many images at once should each use their own render
+ * context, \ref cgifh_ctx_t, to keep the memory and caches that drawing
+ * reuses from call to call.
+ */
+
+/**
+ * Mark a symbol as part of the library's public interface.
+ *
+ * The library is built with hidden symbol visibility by default, so only
+ * symbols marked with this are exported from the shared library.
+ */
+#if defined(__GNUC__)
+#define CGIFH_API __attribute__((visibility("default")))
+#else
+#define CGIFH_API
+#endif
+
 /** Maximum number of palette entries. */
 #define CGIFH_PALETTE_MAX 256
 
@@ -22,8 +49,26 @@
 /** Glyph height in pixels. */
 #define CGIFH_GLYPH_HEIGHT 8
 
+/**
+ * Rectangle.
+ */
+typedef struct cgifh_rect {
+	int x; /**< X coordinate of the left edge. */
+	int y; /**< Y coordinate of the top edge. */
+	int w; /**< Width in pixels. */
+	int h; /**< Height in pixels. */
+} cgifh_rect_t;
+
+/**
+ * Render context.
+ */
+typedef struct cgifh_ctx cgifh_ctx_t;
+
 /**
  * CGIF Helper image structure.
+ *
+ * Drawing is clipped to the image's clip rectangle, which is the whole
+ * image unless it is set with \ref cgifh_clip_set.
  */
 typedef struct cgifh {
 	/** RGB palette */
@@ -34,9 +79,53 @@ typedef struct cgifh {
 	int width;    /**< Image width in pixels. */
 	int height;   /**< Image height in pixels. */
 	size_t size;  /**< Image data size in bytes. */
-	uint8_t data[]; /**< Image data. */
+
+	/** Clip rectangle, as half open ranges within the image. */
+	struct {
+		int x0; /**< Left edge. */
+		int y0; /**< Top edge. */
+		int x1; /**< Right edge, exclusive. */
+		int y1; /**< Bottom edge, exclusive. */
+	} clip;
+
+	/**
+	 * Area the clip rectangle is confined to, as half open ranges.
+	 *
+	 * This is the whole image, except for the band images passed to
+	 * \ref cgifh_draw_bands callbacks.
+	 */
+	struct {
+		int x0; /**< Left edge. */
+		int y0; /**< Top edge. */
+		int x1; /**< Right edge, exclusive. */
+		int y1; /**< Bottom edge, exclusive. */
+	} bounds;
+
+	/** Open groups, see \ref cgifh_group_begin. */
+	struct {
+		unsigned depth;  /**< Number of open groups. */
+		unsigned culled; /**< Depth of the culled group, or 0. */
+		int x0; /**< Left edge of the clip rectangle to restore. */
+		int y0; /**< Top edge of the clip rectangle to restore. */
+		int x1; /**< Right edge of the clip rectangle to restore. */
+		int y1; /**< Bottom edge of the clip rectangle to restore. */
+	} group;
+
+	/** Render context the image was created in, or NULL. */
+	cgifh_ctx_t *ctx;
+
+	uint8_t *data; /**< Image data. */
 } cgifh_t;
 
+/**
+ * Dithering modes for converting RGB colours to palette indexes.
+ */
+typedef enum cgifh_dither {
+	CGIFH_DITHER_NONE,            /**< Nearest palette colour. */
+	CGIFH_DITHER_ORDERED,         /**< 4x4 Bayer ordered dither. */
+	CGIFH_DITHER_FLOYD_STEINBERG, /**< Floyd-Steinberg error diffusion. */
+} cgifh_dither_t;
+
 /**
  * Add a colour to the image palette.
  *
@@ -47,7 +136,7 @@ typedef struct cgifh {
  * \param[out] idx_out Pointer to variable to receive the palette index.
  * \return true if the colour was added, false if the palette is full.
  */
-bool cgifh_palette_add(cgifh_t *img,
+CGIFH_API bool cgifh_palette_add(cgifh_t *img,
 		uint8_t r,
 		uint8_t g,
 		uint8_t b,
@@ -63,7 +152,7 @@ bool cgifh_palette_add(cgifh_t *img,
  * \param[out] idx_out Pointer to variable to receive the palette index.
  * \return true if the colour was added, false if the palette is full.
  */
-bool cgifh_palette_add_blend(cgifh_t *img,
+CGIFH_API bool cgifh_palette_add_blend(cgifh_t *img,
 		uint8_t idx0,
 		uint8_t idx1,
 		uint8_t pos,
@@ -76,14 +165,603 @@ bool cgifh_palette_add_blend(cgifh_t *img,
  * \param[in] height Image height in pixels.
  * \return Pointer to the new image, or NULL on failure.
  */
-cgifh_t *cgifh_create(size_t width, size_t height);
+CGIFH_API cgifh_t *cgifh_create(size_t width, size_t height);
+
+/**
+ * Create an image from RGB pixel data.
+ *
+ * A palette of up to max_colours colours is built for the RGB data using
+ * the median cut algorithm, and the RGB data is converted to it.
+ *
+ * Building the colour histogram is split between threads.
+ *
+ * \param[in] rgb         The RGB pixel data, three bytes per pixel.
+ * \param[in] width       Image width in pixels.
+ * \param[in] height      Image height in pixels.
+ * \param[in] stride      The number of bytes from the start of one row of
+ *                        the RGB data to the start of the next.
+ * \param[in] max_colours The maximum number of palette entries, 1 to 256.
+ * \param[in] dither      The dithering mode for converting to the palette.
+ * \param[in] threads     Number of threads to use, or 0 to use one per
+ *                        online CPU.
+ * \return Pointer to the new image, or NULL on failure.
+ */
+CGIFH_API cgifh_t *cgifh_create_from_rgb(
+		const uint8_t *rgb,
+		size_t width,
+		size_t height,
+		size_t stride,
+		unsigned max_colours,
+		cgifh_dither_t dither,
+		unsigned threads);
 
 /**
  * Destroy an image.
  *
  * \param[in] img The image to destroy.
  */
-void cgifh_destroy(cgifh_t *img);
+CGIFH_API void cgifh_destroy(cgifh_t *img);
+
+/**
+ * Memory allocator for a render context.
+ */
+typedef struct cgifh_allocator {
+	/**
+	 * Allocate memory.
+	 *
+	 * \param[in] pw   The allocator's private word.
+	 * \param[in] size Number of bytes to allocate.
+	 * \return The memory, suitably aligned for any type, or NULL.
+	 */
+	void *(*alloc)(void *pw, size_t size);
+
+	/**
+	 * Free memory.
+	 *
+	 * \param[in] pw  The allocator's private word.
+	 * \param[in] ptr Memory from the alloc function, or NULL.
+	 */
+	void (*free)(void *pw, void *ptr);
+
+	void *pw; /**< Private word passed to the functions. */
+} cgifh_allocator_t;
+
+/**
+ * Render context configuration.
+ *
+ * A zero initialised configuration gives a context that uses the standard
+ * C allocator and has no text layout cache. Text layouts are reference
+ * counted and may outlive their cache, so they always use the standard C
+ * allocator.
+ */
+typedef struct cgifh_ctx_config {
+	/** Allocator, or NULL for the standard C allocator. */
+	const cgifh_allocator_t *allocator;
+	/** Number of text layouts to cache, or 0 for no text cache. */
+	size_t text_cache_capacity;
+} cgifh_ctx_config_t;
+
+/**
+ * Render context statistics.
+ */
+typedef struct cgifh_stats {
+	size_t images;         /**< Images created in the context. */
+	size_t allocs;         /**< Allocations made with the allocator. */
+	size_t alloc_failures; /**< Allocations that failed. */
+	size_t scratch_reuses; /**< Working memory needs met without allocating. */
+	size_t layout_hits;    /**< Text layouts found in the text cache. */
+	size_t layout_misses;  /**< Text layouts not found in the text cache. */
+	size_t groups_culled;  /**< Groups skipped for being outside the clip. */
+	size_t layer_hits;     /**< Layers drawn from their cached pixels. */
+	size_t layer_misses;   /**< Layers drawn by their draw callback. */
+} cgifh_stats_t;
+
+/**
+ * Create a render context.
+ *
+ * A render context holds the allocator, caches and statistics for drawing
+ * into the images created in it. Drawing into those images reuses the
+ * context's working memory instead of allocating for each call. A context
+ * and its images must only be used by one thread at a time; threads that
+ * render concurrently should each have their own context.
+ *
+ * \param[in] config Context configuration, or NULL for the defaults.
+ * \return Pointer to the new context, or NULL on failure.
+ */
+CGIFH_API cgifh_ctx_t *cgifh_ctx_create(const cgifh_ctx_config_t *config);
+
+/**
+ * Destroy a render context.
+ *
+ * Images created in the context must be destroyed first.
+ *
+ * \param[in] ctx The context to destroy.
+ */
+CGIFH_API void cgifh_ctx_destroy(cgifh_ctx_t *ctx);
+
+/**
+ * Create an image in a render context.
+ *
+ * The image is as created by \ref cgifh_create, but its memory comes from
+ * the context's allocator, and drawing into it uses the context.
+ *
+ * \param[in] ctx    The context to create the image in.
+ * \param[in] width  The width of the image in pixels.
+ * \param[in] height The height of the image in pixels.
+ * \return Pointer to the new image, or NULL on failure.
+ */
+CGIFH_API cgifh_t *cgifh_ctx_create_image(
+		cgifh_ctx_t *ctx,
+		size_t width,
+		size_t height);
+
+/**
+ * Get a render context's statistics.
+ *
+ * \param[in]  ctx   The context.
+ * \param[out] stats Returns the statistics.
+ */
+CGIFH_API void cgifh_ctx_stats(const cgifh_ctx_t *ctx, cgifh_stats_t *stats);
+
+/**
+ * Set an image's clip rectangle.
+ *
+ * Drawing is clipped to the part of the rectangle within the image. For the
+ * band images passed to \ref cgifh_draw_bands callbacks, the clip rectangle
+ * is also kept within the band.
+ *
+ * \param[in] img The image to set the clip rectangle of.
+ * \param[in] x   The x coordinate of the rectangle.
+ * \param[in] y   The y coordinate of the rectangle.
+ * \param[in] w   The width of the rectangle.
+ * \param[in] h   The height of the rectangle.
+ */
+CGIFH_API void cgifh_clip_set(
+		cgifh_t *img,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Reset an image's clip rectangle to the whole image.
+ *
+ * For the band images passed to \ref cgifh_draw_bands callbacks, the clip
+ * rectangle is reset to the band.
+ *
+ * \param[in] img The image to reset the clip rectangle of.
+ */
+CGIFH_API void cgifh_clip_reset(cgifh_t *img);
+
+/**
+ * Get an image's clip rectangle.
+ *
+ * \param[in] img The image to get the clip rectangle of.
+ * \return The clip rectangle.
+ */
+CGIFH_API cgifh_rect_t cgifh_clip_get(const cgifh_t *img);
+
+/**
+ * Begin a group of drawing calls.
+ *
+ * The rectangle must contain everything the group draws. If none of it is
+ * within the clip rectangle, the group is culled: every drawing call until
+ * the matching \ref cgifh_group_end draws nothing, and returns as soon as it
+ * has checked its own bounds. Groups can be nested, and any group within a
+ * culled group is culled too.
+ *
+ * The clip rectangle is empty while a group is culled. Changes made to the
+ * clip rectangle during a culled group take effect when the group ends.
+ *
+ * \param[in] img The image to draw into.
+ * \param[in] x   The x coordinate of the group's bounding box.
+ * \param[in] y   The y coordinate of the group's bounding box.
+ * \param[in] w   The width of the group's bounding box.
+ * \param[in] h   The height of the group's bounding box.
+ * \return true if the group may be visible, false if it is culled, in which
+ *         case the caller can skip drawing it altogether.
+ */
+CGIFH_API bool cgifh_group_begin(
+		cgifh_t *img,
+		int x, int y,
+		int w, int h);
+
+/**
+ * End a group of drawing calls begun with \ref cgifh_group_begin.
+ *
+ * \param[in] img The image the group was drawn into.
+ */
+CGIFH_API void cgifh_group_end(cgifh_t *img);
+
+/**
+ * Callback to draw into an image.
+ *
+ * \param[in] img The image to draw into.
+ * \param[in] pw  The caller's private data.
+ */
+typedef void (*cgifh_draw_fn)(cgifh_t *img, void *pw);
+
+/**
+ * Draw into an image in horizontal bands, in parallel.
+ *
+ * The image is split into bands of rows, and the draw callback is called
+ * once for each band, on its own thread. Each call gets a band image, which
+ * shares the image's pixels, but has its own copy of the palette and has its
+ * clip rectangle confined to the band, so the calls draw only their own
+ * rows. Calls to
+ * \ref cgifh_clip_set and \ref cgifh_clip_reset on a band image stay within
+ * the band.
+ *
+ * The output is identical to calling the callback once on the image, as long
+ * as the callback makes the same calls for every band, and does not read
+ * pixels. Palette changes are made to each band image's copy of the palette,
+ * and only the first band's palette is copied to the image when drawing is
+ * finished: colours the other bands add are discarded, so they must add the
+ * same colours in the same order as the first band. The image's clip
+ * rectangle is not changed. Band images must not
+ * be destroyed or kept after the callback returns.
+ *
+ * Each band needs its own render context. The contexts array has an entry
+ * for each band. If it is NULL, the first band uses the image's context and
+ * the other bands draw without one. The callback can get a band's text
+ * cache with \ref cgifh_ctx_text_cache.
+ *
+ * Bands skip the work for rows outside them, except where a row's output
+ * depends on the rows above it: every band repeats the error diffusion of
+ * \ref CGIFH_DITHER_FLOYD_STEINBERG from the top of the dithered area.
+ *
+ * If a thread can't be created, its band is drawn by the calling thread.
+ *
+ * \param[in] img      The image to draw into.
+ * \param[in] bands    The number of bands, or 0 to pick one for each CPU.
+ *                     Must not be 0 if contexts are given.
+ * \param[in] contexts Array of render contexts, one for each band, or NULL.
+ * \param[in] draw     The draw callback.
+ * \param[in] pw       Private data passed to the draw callback.
+ */
+CGIFH_API void cgifh_draw_bands(
+		cgifh_t *img,
+		unsigned bands,
+		cgifh_ctx_t *const *contexts,
+		cgifh_draw_fn draw,
+		void *pw);
+
+/**
+ * Opaque thread pool for rendering frames.
+ */
+typedef struct cgifh_pool cgifh_pool_t;
+
+/**
+ * Callback to render a frame.
+ *
+ * Called on a pool thread. The image is recycled from an earlier frame, so
+ * its pixels are left over from that frame, but its palette is empty and
+ * its clip rectangle is the whole image.
+ *
+ * \param[in] img   The image to render the frame into.
+ * \param[in] frame The frame number.
+ * \param[in] pw    The caller's private data.
+ * \return true on success, false to stop rendering.
+ */
+typedef bool (*cgifh_frame_render_fn)(cgifh_t *img, size_t frame, void *pw);
+
+/**
+ * Callback to take a rendered frame.
+ *
+ * Called on the thread that called \ref cgifh_pool_render, once for each
+ * frame, in frame order. The image is reused for another frame once this
+ * returns.
+ *
+ * \param[in] img   The rendered frame.
+ * \param[in] frame The frame number.
+ * \param[in] pw    The caller's private data.
+ * \return true on success, false to stop rendering.
+ */
+typedef bool (*cgifh_frame_output_fn)(
+		const cgifh_t *img,
+		size_t frame,
+		void *pw);
+
+/**
+ * Frame rendering job.
+ */
+typedef struct cgifh_frames {
+	size_t width;       /**< Frame width in pixels. */
+	size_t height;      /**< Frame height in pixels. */
+	size_t count;       /**< Number of frames to render. */
+	/**
+	 * Number of frame images, which limits how far rendering can get
+	 * ahead of output, or 0 for four for each pool thread.
+	 */
+	size_t images;
+	cgifh_frame_render_fn render; /**< Frame render callback. */
+	cgifh_frame_output_fn output; /**< Frame output callback. */
+	void *pw;           /**< Private data passed to the callbacks. */
+} cgifh_frames_t;
+
+/**
+ * Create a thread pool for rendering frames.
+ *
+ * Each thread has its own render context, created with the given
+ * configuration, which the images it renders into use.
+ *
+ * \param[in] threads The number of threads, or 0 for one for each CPU.
+ * \param[in] config  Render context configuration, or NULL for defaults.
+ * \return Pointer to the new pool, or NULL on failure.
+ */
+CGIFH_API cgifh_pool_t *cgifh_pool_create(
+		unsigned threads,
+		const cgifh_ctx_config_t *config);
+
+/**
+ * Destroy a thread pool.
+ *
+ * \param[in] pool The pool to destroy.
+ */
+CGIFH_API void cgifh_pool_destroy(cgifh_pool_t *pool);
+
+/**
+ * Render frames on a thread pool.
+ *
+ * Frames are handed to the pool's threads in small batches, in frame
+ * order. A thread that runs out of frames while the others still have some
+ * queued takes frames from them, so a few slow frames don't leave threads
+ * idle. Rendered frames are passed to the output callback in frame order
+ * on the calling thread.
+ *
+ * The frame images are kept by the pool and reused by later calls with
+ * the same frame size and image count. A pool renders one job at a time.
+ *
+ * \param[in] pool   The pool to render with.
+ * \param[in] frames The frames to render.
+ * \return true on success, false if a callback failed or on memory
+ *         allocation failure.
+ */
+CGIFH_API bool cgifh_pool_render(
+		cgifh_pool_t *pool,
+		const cgifh_frames_t *frames);
+
+/**
+ * Opaque cached layer.
+ */
+typedef struct cgifh_layer cgifh_layer_t;
+
+/**
+ * Create a cached layer.
+ *
+ * A layer caches the pixels a draw callback draws within an area, so that
+ * drawing it again with the same inputs copies the cached pixels instead
+ * of calling the callback.
+ *
+ * Opaque layers must draw every pixel of their area, and their pixels are
+ * copied as a block. Other layers may leave pixels untouched, and only the
+ * pixels they drew are copied, at the cost of calling the callback twice
+ * whenever the cache is refreshed.
+ *
+ * \param[in] ctx    Render context to allocate from, or NULL.
+ * \param[in] x      The x coordinate of the layer's area.
+ * \param[in] y      The y coordinate of the layer's area.
+ * \param[in] w      The width of the layer's area.
+ * \param[in] h      The height of the layer's area.
+ * \param[in] opaque Whether the layer draws every pixel of its area.
+ * \return Pointer to the new layer, or NULL on failure.
+ */
+CGIFH_API cgifh_layer_t *cgifh_layer_create(
+		cgifh_ctx_t *ctx,
+		int x, int y,
+		int w, int h,
+		bool opaque);
+
+/**
+ * Destroy a cached layer.
+ *
+ * \param[in] layer The layer to destroy.
+ */
+CGIFH_API void cgifh_layer_destroy(cgifh_layer_t *layer);
+
+/**
+ * Draw a cached layer.
+ *
+ * The key describes everything the draw callback's output depends on,
+ * such as the values it draws and their positions. If the key, the image's
+ * palette, size and clip rectangle are all the same as when the layer was
+ * last drawn, the cached pixels are copied into the image, and palette
+ * entries the callback added are added again. Otherwise the callback is
+ * called, with the clip rectangle confined to the layer's area, and its
+ * output is cached.
+ *
+ * The callback must not read pixels, and its output must depend only on
+ * the key and the image's palette.
+ *
+ * A layer must only be used from one thread at a time, and must not be
+ * shared between the band images of \ref cgifh_draw_bands callbacks: the
+ * bands would race on its cached pixels, and since each band has its own
+ * clip rectangle, none of them would hit the cache. Give each band or
+ * thread its own layer.
+ *
+ * \param[in] img      The image to draw into.
+ * \param[in] layer    The layer to draw.
+ * \param[in] key      The layer's inputs.
+ * \param[in] key_size The size of the key in bytes.
+ * \param[in] draw     The draw callback.
+ * \param[in] pw       Private data passed to the draw callback.
+ * \return true on success, false on memory allocation failure, in which
+ *         case the layer is drawn without caching.
+ */
+CGIFH_API bool cgifh_layer_draw(
+		cgifh_t *img,
+		cgifh_layer_t *layer,
+		const void *key,
+		size_t key_size,
+		cgifh_draw_fn draw,
+		void *pw);
+
+/**
+ * Get a pointer to the start of a row of an image.
+ *
+ * Per-pixel work on a row should index the returned pointer directly, which
+ * lets the compiler vectorise the loop. Stores through the pointer may alias
+ * the image structure, so copy the image width to a local variable before
+ * using it as the loop bound.
+ *
+ * This function does not clip, so it is up to the caller to ensure that y is
+ * in range.
+ *
+ * \param[in] img The image to get the row of.
+ * \param[in] y   The y coordinate of the row.
+ * \return Pointer to the first pixel of the row.
+ */
+static inline uint8_t *cgifh_row(cgifh_t *img, int y)
+{
+	return img->data + (size_t) y * (size_t) img->width;
+}
+
+/**
+ * Get a pointer to the start of a row of a read-only image.
+ *
+ * This function does not clip, so it is up to the caller to ensure that y is
+ * in range.
+ *
+ * \param[in] img The image to get the row of.
+ * \param[in] y   The y coordinate of the row.
+ * \return Pointer to the first pixel of the row.
+ */
+static inline const uint8_t *cgifh_row_const(const cgifh_t *img, int y)
+{
+	return img->data + (size_t) y * (size_t) img->width;
+}
+
+/**
+ * Check whether a pixel is within an image.
+ *
+ * \param[in] img The image to check against.
+ * \param[in] x   The x coordinate of the pixel.
+ * \param[in] y   The y coordinate of the pixel.
+ * \return true if the pixel is within the image, false otherwise.
+ */
+static inline bool cgifh_pixel_in_bounds(const cgifh_t *img, int x, int y)
+{
+	/* Negative values wrap to large unsigned values, so one comparison
+	 * per axis is enough. Subtracting the start of a range first makes
+	 * values before it wrap, which tests any range the same way. */
+	return (unsigned) x < (unsigned) img->width &&
+	       (unsigned) y < (unsigned) img->height;
+}
+
+/**
+ * Get the colour of a pixel in an image.
+ *
+ * This function does not clip the pixel coordinates, so it is up to the caller
+ * to ensure that x and y are in range.
+ *
+ * \param[in] img The image to get the pixel from.
+ * \param[in] x   The x coordinate of the pixel.
+ * \param[in] y   The y coordinate of the pixel.
+ * \return The palette index of the pixel.
+ */
+static inline uint8_t cgifh_pixel_get(const cgifh_t *img, int x, int y)
+{
+	return cgifh_row_const(img, y)[x];
+}
+
+/**
+ * Set a pixel in an image.
+ *
+ * This function does not clip the pixel coordinates, so it is up to the caller
+ * to ensure that x and y are in range.
+ *
+ * \param[in] img    The image to set the pixel in.
+ * \param[in] colour The palette index of the colour to set the pixel to.
+ * \param[in] x      The x coordinate of the pixel.
+ * \param[in] y      The y coordinate of the pixel.
+ */
+static inline void cgifh_pixel(
+		cgifh_t *img,
+		uint8_t colour,
+		int x,
+		int y)
+{
+	cgifh_row(img, y)[x] = colour;
+}
+
+/**
+ * Check whether a pixel is within an image's clip rectangle.
+ *
+ * \param[in] img The image to check against.
+ * \param[in] x   The x coordinate of the pixel.
+ * \param[in] y   The y coordinate of the pixel.
+ * \return true if the pixel is within the clip rectangle, false otherwise.
+ */
+static inline bool cgifh_pixel_in_clip(const cgifh_t *img, int x, int y)
+{
+	return (unsigned) x - (unsigned) img->clip.x0 <
+			(unsigned) (img->clip.x1 - img->clip.x0) &&
+	       (unsigned) y - (unsigned) img->clip.y0 <
+			(unsigned) (img->clip.y1 - img->clip.y0);
+}
+
+/**
+ * Result of testing a rectangle against an image's clip rectangle.
+ */
+typedef enum cgifh_cull {
+	CGIFH_CULL_OUTSIDE, /**< None of the rectangle is within the clip. */
+	CGIFH_CULL_PARTIAL, /**< Some of the rectangle is within the clip. */
+	CGIFH_CULL_INSIDE,  /**< All of the rectangle is within the clip. */
+} cgifh_cull_t;
+
+/**
+ * Test a bounding box against an image's clip rectangle.
+ *
+ * Drawing of anything outside the clip rectangle can be skipped, and
+ * anything inside it needs no clipping.
+ *
+ * \param[in] img The image to test against.
+ * \param[in] x   The x coordinate of the rectangle.
+ * \param[in] y   The y coordinate of the rectangle.
+ * \param[in] w   The width of the rectangle.
+ * \param[in] h   The height of the rectangle.
+ * \return Whether the rectangle is outside, partially inside, or inside the
+ *         clip rectangle. Empty rectangles are outside.
+ */
+static inline cgifh_cull_t cgifh_rect_test(
+		const cgifh_t *img,
+		int x, int y,
+		int w, int h)
+{
+	int64_t x1 = (int64_t) x + w;
+	int64_t y1 = (int64_t) y + h;
+
+	if (w <= 0 || h <= 0 ||
+	    img->clip.x0 >= img->clip.x1 || img->clip.y0 >= img->clip.y1 ||
+	    x >= img->clip.x1 || x1 <= img->clip.x0 ||
+	    y >= img->clip.y1 || y1 <= img->clip.y0) {
+		return CGIFH_CULL_OUTSIDE;
+	}
+
+	if (x >= img->clip.x0 && x1 <= img->clip.x1 &&
+	    y >= img->clip.y0 && y1 <= img->clip.y1) {
+		return CGIFH_CULL_INSIDE;
+	}
+
+	return CGIFH_CULL_PARTIAL;
+}
+
+/**
+ * Set a pixel in an image, if the pixel is within its clip rectangle.
+ *
+ * \param[in] img    The image to set the pixel in.
+ * \param[in] colour The palette index of the colour to set the pixel to.
+ * \param[in] x      The x coordinate of the pixel.
+ * \param[in] y      The y coordinate of the pixel.
+ */
+static inline void cgifh_pixel_clipped(
+		cgifh_t *img,
+		uint8_t colour,
+		int x,
+		int y)
+{
+	if (cgifh_pixel_in_clip(img, x, y)) {
+		cgifh_pixel(img, colour, x, y);
+	}
+}
 
 /**
  * Draw a vertical line.
@@ -94,7 +772,7 @@ void cgifh_destroy(cgifh_t *img);
  * \param[in] y1     The bottom y coordinate of the line.
  * \param[in] x      The x coordinate of the line.
  */
-void cgifh_v_line(
+CGIFH_API void cgifh_v_line(
 		cgifh_t *img,
 		uint8_t colour,
 		int y0,
@@ -110,7 +788,7 @@ void cgifh_v_line(
  * \param[in] x1     The right x coordinate of the line.
  * \param[in] y      The y coordinate of the line.
  */
-void cgifh_h_line(
+CGIFH_API void cgifh_h_line(
 		cgifh_t *img,
 		uint8_t colour,
 		int x0,
@@ -127,7 +805,7 @@ void cgifh_h_line(
  * \param[in] x1     The x coordinate of the end of the line.
  * \param[in] y1     The y coordinate of the end of the line.
  */
-void cgifh_line(
+CGIFH_API void cgifh_line(
 		cgifh_t *img,
 		uint8_t colour,
 		int x0, int y0,
@@ -143,24 +821,344 @@ void cgifh_line(
  * \param[in] w      The width of the rectangle.
  * \param[in] h      The height of the rectangle.
  */
-void cgifh_rect_fill(
+CGIFH_API void cgifh_rect_fill(
 		cgifh_t *img,
 		uint8_t colour,
 		int x, int y,
 		int w, int h);
 
+/**
+ * Clear an entire image to a single colour.
+ *
+ * This is much faster than filling the image with \ref cgifh_rect_fill.
+ *
+ * \param[in] img    The image to clear.
+ * \param[in] colour The palette index of the colour to clear the image to.
+ */
+CGIFH_API void cgifh_clear(
+		cgifh_t *img,
+		uint8_t colour);
+
+/**
+ * Draw a rectangle filled with a checkerboard pattern.
+ *
+ * The pattern is anchored to the image origin, so adjacent fills line up.
+ *
+ * \param[in] img     The image to draw a rectangle in.
+ * \param[in] colour0 The palette index of the first colour.
+ * \param[in] colour1 The palette index of the second colour.
+ * \param[in] cell    The size of each checkerboard cell in pixels (minimum 1).
+ * \param[in] x       The x coordinate of the top left corner of the rectangle.
+ * \param[in] y       The y coordinate of the top left corner of the rectangle.
+ * \param[in] w       The width of the rectangle.
+ * \param[in] h       The height of the rectangle.
+ */
+CGIFH_API void cgifh_rect_fill_checker(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int cell,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a rectangle filled with horizontal stripes.
+ *
+ * The pattern is anchored to the image origin, so adjacent fills line up.
+ *
+ * \param[in] img     The image to draw a rectangle in.
+ * \param[in] colour0 The palette index of the first colour.
+ * \param[in] colour1 The palette index of the second colour.
+ * \param[in] size    The height of each stripe in pixels (minimum 1).
+ * \param[in] x       The x coordinate of the top left corner of the rectangle.
+ * \param[in] y       The y coordinate of the top left corner of the rectangle.
+ * \param[in] w       The width of the rectangle.
+ * \param[in] h       The height of the rectangle.
+ */
+CGIFH_API void cgifh_rect_fill_h_stripes(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int size,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a rectangle filled with vertical stripes.
+ *
+ * The pattern is anchored to the image origin, so adjacent fills line up.
+ *
+ * \param[in] img     The image to draw a rectangle in.
+ * \param[in] colour0 The palette index of the first colour.
+ * \param[in] colour1 The palette index of the second colour.
+ * \param[in] size    The width of each stripe in pixels (minimum 1).
+ * \param[in] x       The x coordinate of the top left corner of the rectangle.
+ * \param[in] y       The y coordinate of the top left corner of the rectangle.
+ * \param[in] w       The width of the rectangle.
+ * \param[in] h       The height of the rectangle.
+ */
+CGIFH_API void cgifh_rect_fill_v_stripes(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int size,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a rectangle filled with an ordered dither of two colours.
+ *
+ * Uses a 4x4 Bayer matrix anchored to the image origin, so adjacent fills
+ * line up.
+ *
+ * \param[in] img     The image to draw a rectangle in.
+ * \param[in] colour0 The palette index of the first colour.
+ * \param[in] colour1 The palette index of the second colour.
+ * \param[in] pos     The position of the blend, 0 is colour0, 255 is colour1.
+ * \param[in] x       The x coordinate of the top left corner of the rectangle.
+ * \param[in] y       The y coordinate of the top left corner of the rectangle.
+ * \param[in] w       The width of the rectangle.
+ * \param[in] h       The height of the rectangle.
+ */
+CGIFH_API void cgifh_rect_fill_dither(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		uint8_t pos,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw RGB pixel data into an image, converting it to palette indexes.
+ *
+ * Each pixel is converted to the image's palette using the given dithering
+ * mode. The palette must have at least one entry.
+ *
+ * Error diffusion depends on the whole of the RGB data, so when dithering
+ * with \ref CGIFH_DITHER_FLOYD_STEINBERG, the output does not depend on how
+ * much of the rectangle is clipped.
+ *
+ * \param[in] img    The image to draw into.
+ * \param[in] dither The dithering mode.
+ * \param[in] rgb    The RGB pixel data, three bytes per pixel.
+ * \param[in] stride The number of bytes from the start of one row of the RGB
+ *                   data to the start of the next.
+ * \param[in] x      The x coordinate to draw the top left pixel at.
+ * \param[in] y      The y coordinate to draw the top left pixel at.
+ * \param[in] w      The width of the RGB data in pixels.
+ * \param[in] h      The height of the RGB data in pixels.
+ * \return true on success, false on memory allocation failure or if the
+ *         palette is empty.
+ */
+CGIFH_API bool cgifh_rgb_to_index(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		const uint8_t *rgb,
+		size_t stride,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a rectangle filled with an RGB colour, dithered to the palette.
+ *
+ * \param[in] img    The image to draw a rectangle in.
+ * \param[in] dither The dithering mode.
+ * \param[in] r      Red component of the colour.
+ * \param[in] g      Green component of the colour.
+ * \param[in] b      Blue component of the colour.
+ * \param[in] x      The x coordinate of the top left corner of the rectangle.
+ * \param[in] y      The y coordinate of the top left corner of the rectangle.
+ * \param[in] w      The width of the rectangle.
+ * \param[in] h      The height of the rectangle.
+ * \return true on success, false on memory allocation failure or if the
+ *         palette is empty.
+ */
+CGIFH_API bool cgifh_rect_fill_rgb(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		uint8_t r,
+		uint8_t g,
+		uint8_t b,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a rectangle filled with an RGB gradient, dithered to the palette.
+ *
+ * The gradient runs from rgb0 at the left (or top) edge of the rectangle to
+ * rgb1 at the right (or bottom) edge.
+ *
+ * \param[in] img      The image to draw a rectangle in.
+ * \param[in] dither   The dithering mode.
+ * \param[in] rgb0     The RGB colour at the start of the gradient.
+ * \param[in] rgb1     The RGB colour at the end of the gradient.
+ * \param[in] vertical Whether the gradient runs top to bottom, rather than
+ *                     left to right.
+ * \param[in] x        The x coordinate of the top left corner of the
+ *                     rectangle.
+ * \param[in] y        The y coordinate of the top left corner of the
+ *                     rectangle.
+ * \param[in] w        The width of the rectangle.
+ * \param[in] h        The height of the rectangle.
+ * \return true on success, false on memory allocation failure or if the
+ *         palette is empty.
+ */
+CGIFH_API bool cgifh_rect_fill_gradient(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		const uint8_t rgb0[CGIFH_CHANNEL_COUNT],
+		const uint8_t rgb1[CGIFH_CHANNEL_COUNT],
+		bool vertical,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Point marker shapes.
+ */
+typedef enum cgifh_marker {
+	CGIFH_MARKER_SQUARE, /**< Filled square. */
+	CGIFH_MARKER_PLUS,   /**< Plus sign. */
+	CGIFH_MARKER_CROSS,  /**< Diagonal cross. */
+} cgifh_marker_t;
+
+/**
+ * Draw a batch of points.
+ *
+ * This is much faster than drawing each point individually. Points are
+ * clipped in bulk and, where it doesn't change the result, drawn in row order
+ * for cache friendly writes.
+ *
+ * Points are drawn as if in array order, so where markers overlap, later
+ * points are drawn over earlier ones.
+ *
+ * Markers are centred on their point. Markers with an even size extend one
+ * pixel further left and up than right and down.
+ *
+ * \param[in] img     The image to draw the points in.
+ * \param[in] colour  The palette index to draw points in, if colours is NULL.
+ * \param[in] colours Array of per-point palette indexes, or NULL.
+ * \param[in] xs      Array of point x coordinates.
+ * \param[in] ys      Array of point y coordinates.
+ * \param[in] count   The number of points.
+ * \param[in] marker  The marker shape to draw at each point.
+ * \param[in] size    The width and height of the markers in pixels.
+ */
+CGIFH_API void cgifh_points(
+		cgifh_t *img,
+		uint8_t colour,
+		const uint8_t *colours,
+		const int *xs,
+		const int *ys,
+		size_t count,
+		cgifh_marker_t marker,
+		int size);
+
+/**
+ * Heat map value scales.
+ */
+typedef enum cgifh_heatmap_scale {
+	CGIFH_HEATMAP_LINEAR, /**< Palette position is linear in value. */
+	CGIFH_HEATMAP_LOG,    /**< Palette position is linear in log(value). */
+} cgifh_heatmap_scale_t;
+
+/**
+ * Heat map sampling modes.
+ */
+typedef enum cgifh_heatmap_sample {
+	/** Use the nearest palette entry to each value. */
+	CGIFH_HEATMAP_NEAREST,
+	/** Ordered dither between the two nearest palette entries. */
+	CGIFH_HEATMAP_DITHER,
+} cgifh_heatmap_sample_t;
+
+/**
+ * Heat map value to palette mapping.
+ *
+ * Values are mapped onto a contiguous run of palette entries. Values outside
+ * the range min to max are clamped to it, as are NaN values and, for the log
+ * scale, values that are not positive.
+ */
+typedef struct cgifh_heatmap {
+	double min;     /**< Value mapped to the first palette entry. */
+	double max;     /**< Value mapped to the last palette entry. */
+	uint8_t first;  /**< Palette index of the first palette entry. */
+	uint16_t count; /**< Number of palette entries, 1 to 256. */
+	cgifh_heatmap_scale_t scale;   /**< Value scale. */
+	cgifh_heatmap_sample_t sample; /**< Sampling mode. */
+} cgifh_heatmap_t;
+
+/**
+ * Draw a heat map of a grid of floating point values.
+ *
+ * The grid is scaled to fill the given rectangle, with each pixel taking the
+ * value of the grid cell it falls in.
+ *
+ * \param[in] img    The image to draw the heat map in.
+ * \param[in] map    The value to palette mapping.
+ * \param[in] grid   The grid of values, in row major order.
+ * \param[in] grid_w The grid width in cells.
+ * \param[in] grid_h The grid height in cells.
+ * \param[in] stride The number of values from the start of one grid row to
+ *                   the start of the next.
+ * \param[in] x      The x coordinate of the top left corner of the rectangle.
+ * \param[in] y      The y coordinate of the top left corner of the rectangle.
+ * \param[in] w      The width of the rectangle.
+ * \param[in] h      The height of the rectangle.
+ * \return true on success, false on memory allocation failure or if the
+ *         mapping is invalid.
+ */
+CGIFH_API bool cgifh_heatmap_float(
+		cgifh_t *img,
+		const cgifh_heatmap_t *map,
+		const float *grid,
+		int grid_w,
+		int grid_h,
+		size_t stride,
+		int x, int y,
+		int w, int h);
+
+/**
+ * Draw a heat map of a grid of integer values.
+ *
+ * The grid is scaled to fill the given rectangle, with each pixel taking the
+ * value of the grid cell it falls in.
+ *
+ * \param[in] img    The image to draw the heat map in.
+ * \param[in] map    The value to palette mapping.
+ * \param[in] grid   The grid of values, in row major order.
+ * \param[in] grid_w The grid width in cells.
+ * \param[in] grid_h The grid height in cells.
+ * \param[in] stride The number of values from the start of one grid row to
+ *                   the start of the next.
+ * \param[in] x      The x coordinate of the top left corner of the rectangle.
+ * \param[in] y      The y coordinate of the top left corner of the rectangle.
+ * \param[in] w      The width of the rectangle.
+ * \param[in] h      The height of the rectangle.
+ * \return true on success, false on memory allocation failure or if the
+ *         mapping is invalid.
+ */
+CGIFH_API bool cgifh_heatmap_int(
+		cgifh_t *img,
+		const cgifh_heatmap_t *map,
+		const int32_t *grid,
+		int grid_w,
+		int grid_h,
+		size_t stride,
+		int x, int y,
+		int w, int h);
+
 /**
  * Draw a character at a given position.
  *
  * \param[in] img       Image to draw on.
  * \param[in] colour    Colour to draw character in.
- * \param[in] character Character to draw.
+ * \param[in] character Latin-1 character to draw.
  * \param[in] scale     Scale factor.
  * \param[in] x         X coordinate to draw character at.
  * \param[in] y         Y coordinate to draw character at.
  * \return The x-advance for the drawn glyph in pixels.
  */
-int cgifh_char(
+CGIFH_API int cgifh_char(
 		cgifh_t *img,
 		uint8_t colour,
 		char character,
@@ -173,14 +1171,14 @@ int cgifh_char(
  *
  * \param[in] img       Image to draw on.
  * \param[in] colour    Colour to draw character in.
- * \param[in] character Character to draw.
+ * \param[in] character Latin-1 character to draw.
  * \param[in] scale_x   Horizontal scale factor.
  * \param[in] scale_y   Vertical scale factor.
  * \param[in] x         X coordinate to draw character at.
  * \param[in] y         Y coordinate to draw character at.
  * \return The x-advance for the drawn glyph in pixels.
 */
-int cgifh_char_scaled(
+CGIFH_API int cgifh_char_scaled(
 		cgifh_t *img,
 		uint8_t colour,
 		char character,
@@ -192,6 +1190,12 @@ int cgifh_char_scaled(
 /**
  * Draw text at a given position.
  *
+ * Text is UTF-8. Bytes that aren't part of valid UTF-8 are taken as
+ * Latin-1 characters. Characters without a glyph are skipped.
+ *
+ * Glyphs outside the clip rectangle are looked up for their advance, but
+ * not drawn.
+ *
  * \param[in] img    Image to draw on.
  * \param[in] colour Colour to draw text in.
  * \param[in] text   Text to draw.
@@ -200,7 +1204,7 @@ int cgifh_char_scaled(
  * \param[in] y      Y coordinate to draw text at.
  * \return The x-advance for the drawn text in pixels.
  */
-int cgifh_text(
+CGIFH_API int cgifh_text(
 		cgifh_t *img,
 		uint8_t colour,
 		const char *text,
@@ -215,7 +1219,7 @@ int cgifh_text(
  * \param[in] scale Scale factor.
  * \return The width of the text in pixels.
  */
-int cgifh_text_width(const char *text, int scale);
+CGIFH_API int cgifh_text_width(const char *text, int scale);
 
 /**
  * Get the height of given text.
@@ -228,4 +1232,410 @@ static inline int cgifh_text_height(int scale)
 	return CGIFH_GLYPH_HEIGHT * scale;
 }
 
+/**
+ * Text rotations, clockwise.
+ */
+typedef enum cgifh_rotate {
+	CGIFH_ROTATE_0,   /**< Not rotated. */
+	CGIFH_ROTATE_90,  /**< Rotated clockwise, reading top to bottom. */
+	CGIFH_ROTATE_180, /**< Upside down. */
+	CGIFH_ROTATE_270, /**< Rotated anticlockwise, reading bottom to top. */
+} cgifh_rotate_t;
+
+/**
+ * Draw rotated text at a given position.
+ *
+ * The text is drawn as by \ref cgifh_text, rotated. The position is the
+ * top left corner of the rotated text's bounding box, which is
+ * \ref cgifh_text_width wide and \ref cgifh_text_height high, or the other
+ * way round for rotations of 90 and 270 degrees.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] text   Text to draw.
+ * \param[in] scale  Scale factor.
+ * \param[in] rotate Rotation to draw text at.
+ * \param[in] x      X coordinate of the rotated text's bounding box.
+ * \param[in] y      Y coordinate of the rotated text's bounding box.
+ * \return The advance for the drawn text in pixels, along its baseline.
+ */
+CGIFH_API int cgifh_text_rotated(
+		cgifh_t *img,
+		uint8_t colour,
+		const char *text,
+		int scale,
+		cgifh_rotate_t rotate,
+		int x,
+		int y);
+
+/**
+ * Bitmap font.
+ *
+ * Text styles take a font, with NULL meaning the built-in 8 pixel font.
+ * Fonts are immutable once created, so one font may be shared by any
+ * number of styles and threads.
+ */
+typedef struct cgifh_font cgifh_font_t;
+
+/**
+ * Create a font from glyph bitmaps.
+ *
+ * Glyph bitmaps are stored one after another, with `height` rows each.
+ * Each row is `(width + 7) / 8` bytes, and the leftmost pixel is the top
+ * bit of its first byte. The glyphs are for consecutive Unicode code
+ * points, starting at `first`. Glyphs with a zero advance and a blank
+ * bitmap are left out, as are glyphs past U+10FFFF.
+ *
+ * \param[in] width    Glyph bitmap width in pixels.
+ * \param[in] height   Glyph height in pixels.
+ * \param[in] first    Code point of the first glyph.
+ * \param[in] count    Number of glyphs.
+ * \param[in] advances Horizontal advance of each glyph in pixels.
+ * \param[in] bitmap   Glyph bitmaps.
+ * \return The new font, or NULL on failure.
+ */
+CGIFH_API cgifh_font_t *cgifh_font_create(
+		int width,
+		int height,
+		unsigned first,
+		unsigned count,
+		const uint8_t *advances,
+		const uint8_t *bitmap);
+
+/**
+ * Load a font from BDF or PSF data in memory.
+ *
+ * PSF version 1 and 2 fonts are recognised from their magic numbers and
+ * anything else is parsed as BDF. Glyphs are mapped by Unicode code
+ * point; PSF fonts without a Unicode table are mapped in glyph order.
+ * Where a code point has more than one glyph, the first is used. A font
+ * can have up to 65536 glyphs. BDF fonts with an advance, bounding box size
+ * or bounding box offset of more than 1020 pixels are rejected.
+ *
+ * \param[in] data Font file contents.
+ * \param[in] size Size of the font file in bytes.
+ * \return The new font, or NULL on failure.
+ */
+CGIFH_API cgifh_font_t *cgifh_font_load_data(
+		const void *data,
+		size_t size);
+
+/**
+ * Load a font from a BDF or PSF file.
+ *
+ * \param[in] path Path to the font file.
+ * \return The new font, or NULL on failure.
+ */
+CGIFH_API cgifh_font_t *cgifh_font_load(const char *path);
+
+/**
+ * Destroy a font.
+ *
+ * \param[in] font The font to destroy.
+ */
+CGIFH_API void cgifh_font_destroy(cgifh_font_t *font);
+
+/**
+ * Get the height of a font.
+ *
+ * \param[in] font The font, or NULL for the built-in font.
+ * \return The height of the font's glyphs in pixels.
+ */
+CGIFH_API int cgifh_font_height(const cgifh_font_t *font);
+
+/**
+ * Horizontal text alignment.
+ */
+typedef enum cgifh_align {
+	CGIFH_ALIGN_LEFT,   /**< Align lines to the left edge. */
+	CGIFH_ALIGN_CENTRE, /**< Centre lines. */
+	CGIFH_ALIGN_RIGHT,  /**< Align lines to the right edge. */
+} cgifh_align_t;
+
+/**
+ * Text effect flags, which may be combined.
+ */
+typedef enum cgifh_text_effect {
+	/** Fill the text's extent, including other effects, behind it. */
+	CGIFH_TEXT_BACKGROUND = (1 << 0),
+	/** Outline the text with a one pixel border. */
+	CGIFH_TEXT_OUTLINE    = (1 << 1),
+	/** Drop shadow, offset right and down by one scaled font pixel. */
+	CGIFH_TEXT_SHADOW     = (1 << 2),
+} cgifh_text_effect_t;
+
+/**
+ * Text effects.
+ *
+ * Text with effects is drawn in one pass, with each pixel written once.
+ * The text is drawn over its outline, which is drawn over its shadow,
+ * which is drawn over the background.
+ */
+typedef struct cgifh_text_effects {
+	unsigned flags;     /**< Combination of \ref cgifh_text_effect_t. */
+	uint8_t background; /**< Background colour. */
+	uint8_t outline;    /**< Outline colour. */
+	uint8_t shadow;     /**< Shadow colour. */
+} cgifh_text_effects_t;
+
+/**
+ * Text spacing flags, which may be combined.
+ *
+ * Glyphs narrower than the advance they are given are centred in it, and
+ * glyphs wider than it keep their own advance.
+ */
+typedef enum cgifh_text_flag {
+	/** Give every digit the advance of the font's widest digit. */
+	CGIFH_TEXT_TABULAR   = (1 << 0),
+	/** Give every glyph the font's glyph width as its advance. */
+	CGIFH_TEXT_MONOSPACE = (1 << 1),
+} cgifh_text_flag_t;
+
+/**
+ * Text style.
+ *
+ * A zero initialised style gives unscaled, left aligned, proportionally
+ * spaced text in the built-in font, without effects.
+ */
+typedef struct cgifh_text_style {
+	const cgifh_font_t *font; /**< Font, or NULL for the built-in font. */
+	int scale;           /**< Scale factor; values below 1 are taken as 1. */
+	cgifh_align_t align; /**< Horizontal alignment of lines. */
+	unsigned flags;      /**< Combination of \ref cgifh_text_flag_t. */
+	cgifh_text_effects_t effects; /**< Effects to draw the text with. */
+} cgifh_text_style_t;
+
+/**
+ * Draw wrapped text in a box.
+ *
+ * The text is broken into lines at newlines and wrapped at spaces to fit
+ * the box width. Words wider than the box are broken. Lines are aligned
+ * within the box according to the style, and anything outside the box is
+ * clipped. Text is decoded as for \ref cgifh_text.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] style  Text style, or NULL for the default style.
+ * \param[in] text   Text to draw.
+ * \param[in] x      X coordinate of the box.
+ * \param[in] y      Y coordinate of the box.
+ * \param[in] w      Width of the box.
+ * \param[in] h      Height of the box.
+ * \return The height of the wrapped text in pixels, which is greater than
+ *         the box height if the text did not fit.
+ */
+CGIFH_API int cgifh_text_box(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_text_style_t *style,
+		const char *text,
+		int x,
+		int y,
+		int w,
+		int h);
+
+/**
+ * Redraw changed text.
+ *
+ * Updates text drawn at a position over a single background colour to
+ * show new text in the same style, redrawing only the parts that differ.
+ * Both texts are laid out as by \ref cgifh_text_layout, without wrapping.
+ * Counters drawn with \ref CGIFH_TEXT_TABULAR keep their digits in place,
+ * so only the digits that change are redrawn.
+ *
+ * \param[in]  img        Image to draw on.
+ * \param[in]  colour     Colour to draw text in.
+ * \param[in]  background Colour the old text was drawn over.
+ * \param[in]  style      Text style, or NULL for the default style.
+ * \param[in]  old_text   Text drawn at the position, or NULL for none.
+ * \param[in]  new_text   Text to draw.
+ * \param[in]  x          X coordinate the text is drawn at.
+ * \param[in]  y          Y coordinate the text is drawn at.
+ * \param[out] changed    Returns the bounding box of the redrawn pixels,
+ *                        which is empty if nothing changed, or NULL.
+ * \return false on memory allocation failure, true otherwise.
+ */
+CGIFH_API bool cgifh_text_update(
+		cgifh_t *img,
+		uint8_t colour,
+		uint8_t background,
+		const cgifh_text_style_t *style,
+		const char *old_text,
+		const char *new_text,
+		int x,
+		int y,
+		cgifh_rect_t *changed);
+
+/**
+ * A glyph positioned by text layout.
+ */
+typedef struct cgifh_layout_glyph {
+	int x;              /**< X offset of the glyph from the layout origin. */
+	int y;              /**< Y offset of the glyph from the layout origin. */
+	uint32_t codepoint; /**< The glyph's Unicode code point. */
+} cgifh_layout_glyph_t;
+
+/**
+ * A line of text positioned by text layout.
+ */
+typedef struct cgifh_layout_line {
+	int x;        /**< X offset of the line from the layout origin. */
+	int y;        /**< Y offset of the line from the layout origin. */
+	int width;    /**< Width of the line in pixels. */
+	size_t first; /**< Index of the line's first glyph. */
+	size_t count; /**< Number of glyphs on the line. */
+} cgifh_layout_line_t;
+
+/**
+ * Laid out text.
+ *
+ * Only glyphs that draw something are included, so spaces are omitted.
+ * Text effects extend the drawn area past the layout's width and height,
+ * by one pixel on every side for an outline, and by the shadow offset
+ * right and down for a shadow.
+ */
+typedef struct cgifh_layout {
+	int width;  /**< Layout width in pixels. */
+	int height; /**< Layout height in pixels. */
+	const cgifh_font_t *font; /**< Font the text was laid out in. */
+	int scale;  /**< Scale factor the text was laid out at. */
+	cgifh_text_effects_t effects; /**< Effects the text is drawn with. */
+	size_t line_count;  /**< Number of lines. */
+	size_t glyph_count; /**< Number of glyphs. */
+	const cgifh_layout_line_t *lines;   /**< Array of lines. */
+	const cgifh_layout_glyph_t *glyphs; /**< Array of glyphs. */
+} cgifh_layout_t;
+
+/**
+ * Text layout cache.
+ */
+typedef struct cgifh_text_cache cgifh_text_cache_t;
+
+/**
+ * Create a text layout cache.
+ *
+ * The cache keeps the most recently used layouts, so laying out the same
+ * text again is a lookup.
+ *
+ * \param[in] capacity The maximum number of layouts to keep.
+ * \return Pointer to the new cache, or NULL on failure.
+ */
+CGIFH_API cgifh_text_cache_t *cgifh_text_cache_create(size_t capacity);
+
+/**
+ * Destroy a text layout cache.
+ *
+ * Layouts obtained from the cache that have not been released remain valid
+ * until they are released.
+ *
+ * \param[in] cache The cache to destroy.
+ */
+CGIFH_API void cgifh_text_cache_destroy(cgifh_text_cache_t *cache);
+
+/**
+ * Get a render context's text layout cache.
+ *
+ * \param[in] ctx The context, or NULL.
+ * \return The context's text cache, or NULL if it has none.
+ */
+CGIFH_API cgifh_text_cache_t *cgifh_ctx_text_cache(cgifh_ctx_t *ctx);
+
+/**
+ * Lay out text.
+ *
+ * Text is broken into lines at newlines. If max_width is positive, lines are
+ * also wrapped at spaces to fit within it, and words too long to fit are
+ * broken between characters. Lines are aligned within the layout width,
+ * which is max_width if it is positive, or the width of the widest line
+ * otherwise. Text is decoded as for \ref cgifh_text.
+ *
+ * The returned layout must be released with \ref cgifh_layout_release.
+ *
+ * \param[in] cache     Layout cache to use, or NULL.
+ * \param[in] style     Text style, or NULL for the default style.
+ * \param[in] text      Text to lay out.
+ * \param[in] max_width Width to wrap lines to, or 0 for no wrapping.
+ * \return The layout, or NULL on memory allocation failure.
+ */
+CGIFH_API const cgifh_layout_t *cgifh_text_layout(
+		cgifh_text_cache_t *cache,
+		const cgifh_text_style_t *style,
+		const char *text,
+		int max_width);
+
+/**
+ * Release a layout.
+ *
+ * \param[in] layout The layout to release.
+ */
+CGIFH_API void cgifh_layout_release(const cgifh_layout_t *layout);
+
+/**
+ * Draw laid out text.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] layout Layout to draw.
+ * \param[in] x      X coordinate to draw the layout's origin at.
+ * \param[in] y      Y coordinate to draw the layout's origin at.
+ */
+CGIFH_API void cgifh_layout_draw(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_layout_t *layout,
+		int x,
+		int y);
+
+/**
+ * Glyph atlas.
+ *
+ * An atlas holds every glyph of a font pre-rendered at a given scale, so
+ * text can be drawn by copying glyph rows rather than by walking glyph
+ * bitmaps. This is fastest for lots of text at scales above 1.
+ */
+typedef struct cgifh_atlas cgifh_atlas_t;
+
+/**
+ * Create a glyph atlas.
+ *
+ * The font must not be destroyed while the atlas exists.
+ *
+ * \param[in] font  Font to render, or NULL for the built-in font.
+ * \param[in] scale Scale factor to render glyphs at.
+ * \return Pointer to the new atlas, or NULL on failure.
+ */
+CGIFH_API cgifh_atlas_t *cgifh_atlas_create(
+		const cgifh_font_t *font,
+		int scale);
+
+/**
+ * Destroy a glyph atlas.
+ *
+ * \param[in] atlas The atlas to destroy.
+ */
+CGIFH_API void cgifh_atlas_destroy(cgifh_atlas_t *atlas);
+
+/**
+ * Draw text from a glyph atlas.
+ *
+ * Text is decoded as for \ref cgifh_text, and drawn on a single line in
+ * the atlas's font and scale. It looks the same as the text drawn with
+ * \ref cgifh_layout_draw, given the same font and scale.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] atlas  Atlas to draw glyphs from.
+ * \param[in] text   Text to draw.
+ * \param[in] x      X coordinate to draw text at.
+ * \param[in] y      Y coordinate to draw text at.
+ * \return The x-advance for the drawn text in pixels.
+ */
+CGIFH_API int cgifh_atlas_text(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_atlas_t *atlas,
+		const char *text,
+		int x,
+		int y);
+
 #endif /* CGIFH_H */
@@ -0,0 +1,306 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Glyph atlas.
+ *
+ * The atlas is a mask image with each glyph's bounding box rendered at the
+ * atlas scale. Set pixels are 0xff and clear pixels are 0, so drawing a
+ * glyph row is a branchless select between the image and the text colour,
+ * which compilers vectorise.
+ *
+ * Glyph boxes are packed into shelves: rows of boxes as tall as the
+ * tallest box placed on them. Glyphs that draw nothing take no space.
+ * Each box is padded with clear pixels to a multiple of CGIFH_ATLAS_ALIGN
+ * wide, so rows can be drawn in whole vectors where the image allows.
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "font.h"
+
+/** Number of font cells across the atlas. */
+#define CGIFH_ATLAS_CELLS 16
+
+/** Largest scaled glyph width or height in pixels. */
+#define CGIFH_ATLAS_MAX_SIZE 4096
+
+/** Glyph box width alignment in pixels; a power of two. */
+#define CGIFH_ATLAS_ALIGN 16
+
+/**
+ * Round a width up to the glyph box alignment.
+ *
+ * \param[in] width The width in pixels.
+ * \return The aligned width.
+ */
+static inline int cgifh_atlas_align(int width)
+{
+	return (width + CGIFH_ATLAS_ALIGN - 1) & ~(CGIFH_ATLAS_ALIGN - 1);
+}
+
+/**
+ * Position of a glyph's box in the atlas mask.
+ */
+typedef struct cgifh_atlas_glyph {
+	int x;     /**< Left column of the glyph's box. */
+	int y;     /**< Top row of the glyph's box. */
+	int width; /**< Padded width of the glyph's box. */
+} cgifh_atlas_glyph_t;
+
+/**
+ * Glyph atlas.
+ */
+struct cgifh_atlas {
+	const cgifh_font_t *font; /**< Font the glyphs are from. */
+	int scale;                /**< Scale the glyphs are rendered at. */
+	int width;                /**< Mask width in pixels. */
+	int height;               /**< Mask height in pixels. */
+	uint8_t *mask;            /**< Mask of rendered glyphs. */
+	cgifh_atlas_glyph_t glyphs[]; /**< Position of each font glyph. */
+};
+
+/**
+ * Place the glyphs of an atlas, and set the atlas height.
+ *
+ * \param[in] atlas The atlas, with its font, scale and width set.
+ * \return false if the atlas would be too tall, true otherwise.
+ */
+static bool cgifh_atlas_place(cgifh_atlas_t *atlas)
+{
+	const cgifh_font_t *font = atlas->font;
+	int scale = atlas->scale;
+	int shelf_height = 0;
+	int x = 0;
+	int y = 0;
+
+	for (unsigned i = 0; i < font->glyph_count; i++) {
+		const cgifh_glyph_box_t *box = &font->glyphs[i].box;
+		int w = cgifh_atlas_align((box->x1 - box->x0) * scale);
+		int h = (box->y1 - box->y0) * scale;
+
+		if (font->glyphs[i].span_count == 0) {
+			atlas->glyphs[i] = (cgifh_atlas_glyph_t) { 0 };
+			continue;
+		}
+
+		if (x + w > atlas->width) {
+			if (y > INT_MAX - shelf_height - CGIFH_ATLAS_MAX_SIZE) {
+				return false;
+			}
+			y += shelf_height;
+			shelf_height = 0;
+			x = 0;
+		}
+
+		atlas->glyphs[i] = (cgifh_atlas_glyph_t) {
+			.x = x,
+			.y = y,
+			.width = w,
+		};
+		shelf_height = (h > shelf_height) ? h : shelf_height;
+		x += w;
+	}
+
+	atlas->height = y + shelf_height;
+	return true;
+}
+
+/**
+ * Render the glyphs of an atlas into its mask.
+ *
+ * \param[in] atlas The atlas, with its glyphs placed and mask allocated.
+ */
+static void cgifh_atlas_render(cgifh_atlas_t *atlas)
+{
+	const cgifh_font_t *font = atlas->font;
+	int scale = atlas->scale;
+
+	for (unsigned i = 0; i < font->glyph_count; i++) {
+		const cgifh_glyph_t *glyph = &font->glyphs[i];
+		const cgifh_atlas_glyph_t *cell = &atlas->glyphs[i];
+
+		for (unsigned s = 0; s < glyph->span_count; s++) {
+			const cgifh_glyph_span_t *span = &glyph->spans[s];
+			int x = cell->x + (span->x0 - glyph->box.x0) * scale;
+			int y = cell->y + (span->row - glyph->box.y0) * scale;
+
+			for (int yy = y; yy < y + scale; yy++) {
+				memset(atlas->mask + (size_t) yy * (size_t)
+						atlas->width + (size_t) x, 0xff,
+						(size_t) ((span->x1 - span->x0) *
+						scale));
+			}
+		}
+	}
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_atlas_t *cgifh_atlas_create(
+		const cgifh_font_t *font,
+		int scale)
+{
+	cgifh_atlas_t *atlas;
+	size_t size;
+
+	font = cgifh_font_get(font);
+	scale = (scale < 1) ? 1 : scale;
+	if (scale > CGIFH_ATLAS_MAX_SIZE / font->width ||
+	    scale > CGIFH_ATLAS_MAX_SIZE / font->height) {
+		return NULL;
+	}
+
+	atlas = malloc(sizeof(*atlas) +
+			font->glyph_count * sizeof(atlas->glyphs[0]));
+	if (atlas == NULL) {
+		return NULL;
+	}
+
+	atlas->font = font;
+	atlas->scale = scale;
+	atlas->width = cgifh_atlas_align(font->width * scale) *
+			CGIFH_ATLAS_CELLS;
+	if (!cgifh_atlas_place(atlas) ||
+	    (size_t) atlas->height > SIZE_MAX / (size_t) atlas->width) {
+		free(atlas);
+		return NULL;
+	}
+
+	size = (size_t) atlas->width * (size_t) atlas->height;
+	atlas->mask = calloc((size > 0) ? size : 1, 1);
+	if (atlas->mask == NULL) {
+		free(atlas);
+		return NULL;
+	}
+
+	cgifh_atlas_render(atlas);
+	return atlas;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_atlas_destroy(cgifh_atlas_t *atlas)
+{
+	if (atlas == NULL) {
+		return;
+	}
+
+	free(atlas->mask);
+	free(atlas);
+}
+
+/**
+ * Draw a row of glyph pixels through a mask.
+ *
+ * \param[in] dst    Image pixels to draw on.
+ * \param[in] mask   Mask row, with 0xff where the glyph is set.
+ * \param[in] colour Colour to draw in.
+ * \param[in] len    Length of the row in pixels.
+ */
+static inline void cgifh_atlas_row(
+		uint8_t *dst,
+		const uint8_t *mask,
+		uint8_t colour,
+		size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = (uint8_t) ((dst[i] & ~mask[i]) | (colour & mask[i]));
+	}
+}
+
+/**
+ * Draw a glyph from an atlas, clipped to the image.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw glyph in.
+ * \param[in] atlas  Atlas to draw the glyph from.
+ * \param[in] glyph  Glyph to draw, from the atlas's font.
+ * \param[in] x      X coordinate to draw glyph at.
+ * \param[in] y      Y coordinate to draw glyph at.
+ */
+static inline void cgifh_atlas_glyph(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_atlas_t *atlas,
+		const cgifh_glyph_t *glyph,
+		int x,
+		int y)
+{
+	const cgifh_atlas_glyph_t *cell =
+			&atlas->glyphs[glyph - atlas->font->glyphs];
+	int x0 = x + glyph->box.x0 * atlas->scale;
+	int y0 = y + glyph->box.y0 * atlas->scale;
+	int x1 = x + glyph->box.x1 * atlas->scale;
+	int y1 = y + glyph->box.y1 * atlas->scale;
+	int max = cell->width;
+	const uint8_t *mask;
+	int len;
+
+	mask = atlas->mask + (size_t) cell->y * (size_t) atlas->width +
+			(size_t) cell->x;
+	if (x0 < img->clip.x0) {
+		mask += img->clip.x0 - x0;
+		max -= img->clip.x0 - x0;
+		x0 = img->clip.x0;
+	}
+	if (y0 < img->clip.y0) {
+		mask += (size_t) (img->clip.y0 - y0) * (size_t) atlas->width;
+		y0 = img->clip.y0;
+	}
+	x1 = (x1 > img->clip.x1) ? img->clip.x1 : x1;
+	y1 = (y1 > img->clip.y1) ? img->clip.y1 : y1;
+	if (x0 >= x1) {
+		return;
+	}
+
+	/* Draw into the box's clear padding where it fits, so rows are
+	 * whole vectors. */
+	max = (max > img->clip.x1 - x0) ? img->clip.x1 - x0 : max;
+	len = cgifh_atlas_align(x1 - x0);
+	len = (len > max) ? max : len;
+
+	for (int yy = y0; yy < y1; yy++) {
+		cgifh_atlas_row(cgifh_row(img, yy) + x0, mask,
+				colour, (size_t) len);
+		mask += atlas->width;
+	}
+}
+
+/* Exported function, documented in cgifh.h */
+int cgifh_atlas_text(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_atlas_t *atlas,
+		const char *text,
+		int x,
+		int y)
+{
+	const cgifh_font_t *font = atlas->font;
+	int scale = atlas->scale;
+	bool visible = y < img->clip.y1 &&
+			y + font->height * scale > img->clip.y0;
+	int advance = 0;
+
+	while (*text != '\0') {
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(font,
+				cgifh_utf8_next(&text));
+
+		if (glyph == NULL || glyph->advance == 0) {
+			continue;
+		}
+
+		if (visible && glyph->span_count != 0 &&
+		    x + advance < img->clip.x1) {
+			cgifh_atlas_glyph(img, colour, atlas, glyph,
+					x + advance, y);
+		}
+		advance += glyph->advance * scale;
+	}
+
+	return advance;
+}
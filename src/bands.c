@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Band parallel drawing.
+ *
+ * Each band is drawn through its own copy of the image structure, which
+ * shares the pixel data but has its own palette, clip rectangle, bounds and
+ * render context. Drawing never writes outside the clip rectangle, so the
+ * bands' threads never write the same pixels.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cgifh.h>
+
+/** Minimum number of rows in each automatically chosen band. */
+#define CGIFH_BANDS_ROWS_MIN 32
+
+/** Maximum number of bands. */
+#define CGIFH_BANDS_MAX 64
+
+/**
+ * Drawing job for one band.
+ */
+typedef struct cgifh_band_job {
+	cgifh_t img;       /**< The band image. */
+	cgifh_draw_fn draw; /**< The draw callback. */
+	void *pw;          /**< Private data for the draw callback. */
+} cgifh_band_job_t;
+
+/**
+ * Draw a band.
+ *
+ * \param[in] pw The \ref cgifh_band_job_t.
+ * \return NULL.
+ */
+static void *cgifh_band_draw(void *pw)
+{
+	cgifh_band_job_t *job = pw;
+
+	job->draw(&job->img, job->pw);
+
+	return NULL;
+}
+
+/**
+ * Get the number of bands to use.
+ *
+ * \param[in] rows  The number of rows to split into bands.
+ * \param[in] bands The number of bands requested, or 0 for automatic.
+ * \return The number of bands to use.
+ */
+static size_t cgifh_band_count(int rows, unsigned bands)
+{
+	size_t count = bands;
+
+	if (count == 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		count = (cpus > 0) ? (size_t) cpus : 1;
+		if (count > (size_t) rows / CGIFH_BANDS_ROWS_MIN) {
+			count = (size_t) rows / CGIFH_BANDS_ROWS_MIN;
+		}
+	}
+
+	if (count > (size_t) rows) {
+		count = (size_t) rows;
+	}
+	if (count > CGIFH_BANDS_MAX) {
+		count = CGIFH_BANDS_MAX;
+	}
+
+	return (count < 1) ? 1 : count;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_draw_bands(
+		cgifh_t *img,
+		unsigned bands,
+		cgifh_ctx_t *const *contexts,
+		cgifh_draw_fn draw,
+		void *pw)
+{
+	cgifh_band_job_t jobs[CGIFH_BANDS_MAX];
+	pthread_t tids[CGIFH_BANDS_MAX];
+	bool started[CGIFH_BANDS_MAX];
+	int rows = img->bounds.y1 - img->bounds.y0;
+	size_t count = cgifh_band_count(rows, bands);
+	int row = img->bounds.y0;
+
+	if (count == 1 && (contexts == NULL || contexts[0] == img->ctx)) {
+		cgifh_t saved = *img;
+
+		/* Restored directly, as cgifh_clip_set would store the clip
+		 * for the end of any culled group the image is in. */
+		draw(img, pw);
+		img->clip = saved.clip;
+		img->bounds = saved.bounds;
+		img->group = saved.group;
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		cgifh_t *band = &jobs[i].img;
+		int band_rows = (img->bounds.y1 - row) / (int) (count - i);
+
+		jobs[i].draw = draw;
+		jobs[i].pw = pw;
+
+		*band = *img;
+		band->bounds.y0 = row;
+		band->bounds.y1 = row + band_rows;
+		band->clip.y0 = (img->clip.y0 > row) ? img->clip.y0 : row;
+		band->clip.y1 = (img->clip.y1 < row + band_rows) ?
+				img->clip.y1 : row + band_rows;
+		if (band->clip.y0 >= band->clip.y1) {
+			band->clip.x0 = band->clip.x1 = 0;
+			band->clip.y0 = band->clip.y1 = 0;
+		}
+		if (contexts != NULL) {
+			band->ctx = contexts[i];
+		} else if (i > 0) {
+			band->ctx = NULL;
+		}
+		row += band_rows;
+
+		/* The calling thread draws the first band itself. */
+		started[i] = (i > 0) && pthread_create(&tids[i], NULL,
+				cgifh_band_draw, &jobs[i]) == 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!started[i]) {
+			cgifh_band_draw(&jobs[i]);
+		}
+	}
+
+	for (size_t i = 1; i < count; i++) {
+		if (started[i]) {
+			pthread_join(tids[i], NULL);
+		}
+	}
+
+	memcpy(img->palette, jobs[0].img.palette, sizeof(img->palette));
+	img->palette_count = jobs[0].img.palette_count;
+}
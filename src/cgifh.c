@@ -8,18 +8,15 @@
  * \file Simple bitmap font.
  */
 
+#include <string.h>
+
 #include <cgifh.h>
 
 #include "bits.h"
+#include "ctx.h"
+#include "dither.h"
 #include "font.h"
-
-/**
- * Get the number of elements in an array.
- *
- * \param[in] _a The array to get the number of elements in.
- * \return The number of elements in the array.
- */
-#define CGIFH_ARRAY_LEN(_a) (sizeof(_a) / sizeof((_a)[0]))
+#include "span.h"
 
 /* Exported function, documented in cgifh.h */
 bool cgifh_palette_add(cgifh_t *img,
@@ -66,7 +63,10 @@ bool cgifh_palette_add_blend(cgifh_t *img,
 }
 
 /* Exported function, documented in cgifh.h */
-cgifh_t *cgifh_create(size_t width, size_t height)
+cgifh_t *cgifh_ctx_create_image(
+		cgifh_ctx_t *ctx,
+		size_t width,
+		size_t height)
 {
 	cgifh_t *img;
 
@@ -74,85 +74,168 @@ cgifh_t *cgifh_create(size_t width, size_t height)
 		return NULL;
 	}
 
-	img = malloc(sizeof(cgifh_t) + width * height);
+	img = cgifh_ctx_alloc(ctx, sizeof(cgifh_t) + width * height);
 	if (img == NULL) {
 		return NULL;
 	}
 
-	img->width = (int) width;
-	img->height = (int) height;
-	img->size = width * height;
-	img->palette_count = 0;
+	cgifh_image_init(img, ctx, width, height);
+	if (ctx != NULL) {
+		ctx->stats.images++;
+	}
 
 	return img;
 }
 
+/* Exported function, documented in cgifh.h */
+cgifh_t *cgifh_create(size_t width, size_t height)
+{
+	return cgifh_ctx_create_image(NULL, width, height);
+}
+
 /* Exported function, documented in cgifh.h */
 void cgifh_destroy(cgifh_t *img)
 {
-	free(img);
+	if (img == NULL) {
+		return;
+	}
+
+	cgifh_ctx_free(img->ctx, img);
 }
 
 /**
- * Prototype for a function to set a pixel in an image.
+ * Store an image's clip rectangle.
  *
- * \param[in] img    The image to set the pixel in.
- * \param[in] colour The palette index of the colour to set the pixel to.
- * \param[in] x      The x coordinate of the pixel.
- * \param[in] y      The y coordinate of the pixel.
+ * While a group is culled, the clip rectangle is kept for when the group
+ * ends.
+ *
+ * \param[in] img The image to set the clip rectangle of.
+ * \param[in] x0  The left edge.
+ * \param[in] y0  The top edge.
+ * \param[in] x1  The right edge, exclusive.
+ * \param[in] y1  The bottom edge, exclusive.
  */
-typedef void (*cgifh_pixel_fn)(
+static void cgifh_clip_store(
 		cgifh_t *img,
-		uint8_t colour,
-		int x,
-		int y);
+		int x0, int y0,
+		int x1, int y1)
+{
+	if (img->group.culled != 0) {
+		img->group.x0 = x0;
+		img->group.y0 = y0;
+		img->group.x1 = x1;
+		img->group.y1 = y1;
+		return;
+	}
 
-/**
- * Set a pixel in an image.
- *
- * This function does not clip the pixel coordinates, so it is up to the caller
- * to ensure that x and y are in range.
- *
- * \param[in] img    The image to set the pixel in.
- * \param[in] colour The palette index of the colour to set the pixel to.
- * \param[in] x      The x coordinate of the pixel.
- * \param[in] y      The y coordinate of the pixel.
- */
-static inline void cgifh_pixel(
+	img->clip.x0 = x0;
+	img->clip.y0 = y0;
+	img->clip.x1 = x1;
+	img->clip.y1 = y1;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_clip_set(
 		cgifh_t *img,
-		uint8_t colour,
-		int x,
-		int y)
+		int x, int y,
+		int w, int h)
+{
+	int64_t x1 = (int64_t) x + w;
+	int64_t y1 = (int64_t) y + h;
+	int x0 = (x < img->bounds.x0) ? img->bounds.x0 : x;
+	int y0 = (y < img->bounds.y0) ? img->bounds.y0 : y;
+
+	x1 = (x1 > img->bounds.x1) ? img->bounds.x1 : x1;
+	y1 = (y1 > img->bounds.y1) ? img->bounds.y1 : y1;
+	if (x0 >= x1 || y0 >= y1) {
+		/* Nothing can be drawn. */
+		x0 = y0 = 0;
+		x1 = y1 = 0;
+	}
+
+	cgifh_clip_store(img, x0, y0, (int) x1, (int) y1);
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_clip_reset(cgifh_t *img)
+{
+	cgifh_clip_store(img, img->bounds.x0, img->bounds.y0,
+			img->bounds.x1, img->bounds.y1);
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_rect_t cgifh_clip_get(const cgifh_t *img)
+{
+	return (cgifh_rect_t) {
+		.x = img->clip.x0,
+		.y = img->clip.y0,
+		.w = img->clip.x1 - img->clip.x0,
+		.h = img->clip.y1 - img->clip.y0,
+	};
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_group_begin(
+		cgifh_t *img,
+		int x, int y,
+		int w, int h)
 {
-	img->data[y * img->width + x] = colour;
+	img->group.depth++;
+
+	if (img->group.culled == 0 &&
+	    cgifh_rect_test(img, x, y, w, h) == CGIFH_CULL_OUTSIDE) {
+		img->group.culled = img->group.depth;
+		img->group.x0 = img->clip.x0;
+		img->group.y0 = img->clip.y0;
+		img->group.x1 = img->clip.x1;
+		img->group.y1 = img->clip.y1;
+		img->clip.x0 = img->clip.y0 = 0;
+		img->clip.x1 = img->clip.y1 = 0;
+		if (img->ctx != NULL) {
+			img->ctx->stats.groups_culled++;
+		}
+	}
+
+	return img->group.culled == 0;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_group_end(cgifh_t *img)
+{
+	if (img->group.depth == 0) {
+		return;
+	}
+
+	if (img->group.culled == img->group.depth) {
+		img->group.culled = 0;
+		cgifh_clip_store(img, img->group.x0, img->group.y0,
+				img->group.x1, img->group.y1);
+	}
+
+	img->group.depth--;
 }
 
 /**
- * Set a pixel in an image, if the pixel is in bounds.
+ * Prototype for a function to set a pixel in an image.
  *
  * \param[in] img    The image to set the pixel in.
  * \param[in] colour The palette index of the colour to set the pixel to.
  * \param[in] x      The x coordinate of the pixel.
  * \param[in] y      The y coordinate of the pixel.
  */
-static inline void cgifh_pixel_clipped(
+typedef void (*cgifh_pixel_fn)(
 		cgifh_t *img,
 		uint8_t colour,
 		int x,
-		int y)
-{
-	if (x >= 0 && x < img->width && y >= 0 && y < img->height) {
-		cgifh_pixel(img, colour, x, y);
-	}
-}
+		int y);
 
 /**
  * Get a pixel setting function for a given rectangle.
  *
- * If the rectangle is entirely within the image bounds, the fast pixel setting
- * function is returned. If the rectangle is entirely outside the image bounds,
- * NULL is returned. If the rectangle is partially within the image bounds, the
- * clipped pixel setting function is returned.
+ * If the rectangle is entirely within the clip rectangle, the fast pixel
+ * setting function is returned. If the rectangle is entirely outside the clip
+ * rectangle, NULL is returned. If the rectangle is partially within the clip
+ * rectangle, the clipped pixel setting function is returned.
  *
  * \param[in] img     The image to get the pixel setting function for.
  * \param[in] test_x0 The left x coordinate of the pixel.
@@ -168,10 +251,10 @@ static inline cgifh_pixel_fn cgifh_get_px_fn(
 		int test_x1,
 		int test_y1)
 {
-	int clip_x0 = 0;
-	int clip_y0 = 0;
-	int clip_x1 = img->width;
-	int clip_y1 = img->height;
+	int clip_x0 = img->clip.x0;
+	int clip_y0 = img->clip.y0;
+	int clip_x1 = img->clip.x1;
+	int clip_y1 = img->clip.y1;
 
 	if (test_x0 > test_x1) {
 		int tmp = test_x0;
@@ -195,7 +278,9 @@ static inline cgifh_pixel_fn cgifh_get_px_fn(
 	if (test_x1 <  clip_x0 ||
 	    test_x0 >= clip_x1 ||
 	    test_y1 <  clip_y0 ||
-	    test_y0 >= clip_y1) {
+	    test_y0 >= clip_y1 ||
+	    clip_x0 >= clip_x1 ||
+	    clip_y0 >= clip_y1) {
 		return NULL;
 	}
 
@@ -288,7 +373,68 @@ void cgifh_line(
 			error += dx;
 			y0 += sy;
 		}
+
+		/* Lines only move one way, so once past the far edge of the
+		 * clip rectangle, nothing more is visible. */
+		if (((sx > 0) ? x0 >= img->clip.x1 : x0 < img->clip.x0) ||
+		    ((sy > 0) ? y0 >= img->clip.y1 : y0 < img->clip.y0)) {
+			break;
+		}
+	}
+}
+
+/**
+ * Clip a rectangle to the image's clip rectangle.
+ *
+ * The rectangle is given as half-open ranges: x0 and y0 are inclusive, and
+ * x1 and y1 are exclusive.
+ *
+ * \param[in]     img The image to clip to.
+ * \param[in,out] x0  The left x coordinate, updated to the clipped value.
+ * \param[in,out] y0  The top y coordinate, updated to the clipped value.
+ * \param[in,out] x1  The right x coordinate, updated to the clipped value.
+ * \param[in,out] y1  The bottom y coordinate, updated to the clipped value.
+ * \return true if any of the rectangle is within the clip rectangle, false
+ *         otherwise.
+ */
+static inline bool cgifh_clip_rect(
+		const cgifh_t *img,
+		int *x0,
+		int *y0,
+		int *x1,
+		int *y1)
+{
+	if (*x0 < img->clip.x0) {
+		*x0 = img->clip.x0;
+	}
+	if (*y0 < img->clip.y0) {
+		*y0 = img->clip.y0;
+	}
+	if (*x1 > img->clip.x1) {
+		*x1 = img->clip.x1;
+	}
+	if (*y1 > img->clip.y1) {
+		*y1 = img->clip.y1;
+	}
+
+	return *x0 < *x1 && *y0 < *y1;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_clear(
+		cgifh_t *img,
+		uint8_t colour)
+{
+	bool stream = cgifh_span_stream(img->size);
+
+	if (img->clip.x0 != 0 || img->clip.y0 != 0 ||
+	    img->clip.x1 != img->width || img->clip.y1 != img->height) {
+		cgifh_rect_fill(img, colour, 0, 0, img->width, img->height);
+		return;
 	}
+
+	cgifh_span_fill(img->data, colour, img->size, stream);
+	cgifh_span_fence(stream);
 }
 
 /* Exported function, documented in cgifh.h */
@@ -298,78 +444,368 @@ void cgifh_rect_fill(
 		int x, int y,
 		int w, int h)
 {
-	cgifh_pixel_fn px = cgifh_get_px_fn(img, x, y, x + w, y + h);
-
-	if (px == NULL) {
+	int x0 = x;
+	int y0 = y;
+	int x1 = x + w;
+	int y1 = y + h;
+	size_t len;
+	bool stream;
+
+	if (!cgifh_clip_rect(img, &x0, &y0, &x1, &y1)) {
 		return;
 	}
 
-	for (int row = y; row < y + h; row++) {
-		for (int col = x; col < x + w; col++) {
-			px(img, colour, col, row);
+	len = (size_t) (x1 - x0);
+	stream = cgifh_span_stream(len * (size_t) (y1 - y0));
+
+	if (x0 == 0 && x1 == img->width) {
+		/* Full width rows are contiguous. */
+		cgifh_span_fill(cgifh_row(img, y0), colour,
+				len * (size_t) (y1 - y0), stream);
+	} else {
+		for (int row = y0; row < y1; row++) {
+			cgifh_span_fill(cgifh_row(img, row) + x0,
+					colour, len, stream);
 		}
 	}
+
+	cgifh_span_fence(stream);
 }
 
 /**
- * Get the glyph for a character.
+ * Two colour fill patterns.
+ */
+typedef enum cgifh_pattern_type {
+	CGIFH_PATTERN_CHECKER,   /**< Checkerboard. */
+	CGIFH_PATTERN_H_STRIPES, /**< Horizontal stripes. */
+	CGIFH_PATTERN_V_STRIPES, /**< Vertical stripes. */
+	CGIFH_PATTERN_DITHER,    /**< 4x4 ordered dither. */
+} cgifh_pattern_type_t;
+
+/**
+ * Two colour fill pattern.
+ */
+typedef struct cgifh_pattern {
+	cgifh_pattern_type_t type; /**< Pattern type. */
+	uint8_t colour[2];         /**< Palette indexes of the two colours. */
+	int size;                  /**< Cell size, or blend position for dither. */
+} cgifh_pattern_t;
+
+/**
+ * Maximum number of distinct rows a pattern may have.
+ */
+#define CGIFH_PATTERN_ROWS_MAX 4
+
+/**
+ * Get the row key for a row of a pattern.
  *
- * \param[in] character  Character to get glyph for.
- * \return Pointer to glyph structure or NULL if character is not supported.
+ * Rows with the same key have identical content.
+ *
+ * \param[in] pattern The pattern to get the row key for.
+ * \param[in] y       The y coordinate of the row in the image.
+ * \return The row key, less than \ref CGIFH_PATTERN_ROWS_MAX.
  */
-static const cgifh_glyph_t *cgifh_get_glyph(char character)
+static inline int cgifh_pattern_row_key(
+		const cgifh_pattern_t *pattern,
+		int y)
 {
-	if ((unsigned char)character >= CGIFH_ARRAY_LEN(font_h8)) {
-		return NULL;
+	switch (pattern->type) {
+	case CGIFH_PATTERN_CHECKER:   /* Fall through. */
+	case CGIFH_PATTERN_H_STRIPES: return (y / pattern->size) & 1;
+	case CGIFH_PATTERN_V_STRIPES: return 0;
+	case CGIFH_PATTERN_DITHER:    return y & 3;
 	}
 
-	return &font_h8[(unsigned char)character];
+	return 0;
+}
+
+/**
+ * Get the horizontal period of a pattern.
+ *
+ * \param[in] pattern The pattern to get the period of.
+ * \return The number of pixels after which pattern rows repeat.
+ */
+static inline size_t cgifh_pattern_period(
+		const cgifh_pattern_t *pattern)
+{
+	switch (pattern->type) {
+	case CGIFH_PATTERN_CHECKER:   /* Fall through. */
+	case CGIFH_PATTERN_V_STRIPES: return (size_t) pattern->size * 2;
+	case CGIFH_PATTERN_H_STRIPES: return 1;
+	case CGIFH_PATTERN_DITHER:    return 4;
+	}
+
+	return 1;
+}
+
+/**
+ * Get the colour of a pattern pixel.
+ *
+ * \param[in] pattern The pattern to get the pixel colour of.
+ * \param[in] x       The x coordinate of the pixel in the image.
+ * \param[in] key     The row key for the pixel's row.
+ * \return The palette index for the pixel.
+ */
+static inline uint8_t cgifh_pattern_px(
+		const cgifh_pattern_t *pattern,
+		int x,
+		int key)
+{
+	switch (pattern->type) {
+	case CGIFH_PATTERN_CHECKER:
+		return pattern->colour[((x / pattern->size) ^ key) & 1];
+	case CGIFH_PATTERN_H_STRIPES:
+		return pattern->colour[key];
+	case CGIFH_PATTERN_V_STRIPES:
+		return pattern->colour[(x / pattern->size) & 1];
+	case CGIFH_PATTERN_DITHER:
+		return pattern->colour[pattern->size >
+				cgifh_dither_threshold(x, key)];
+	}
+
+	return pattern->colour[0];
+}
+
+/**
+ * Extend a periodic span by copying its start over the rest of it.
+ *
+ * The copies double in size each time, so long spans are written with a
+ * handful of wide copies rather than per pixel.
+ *
+ * \param[in,out] span   The span, with its first period already rendered.
+ * \param[in]     period The number of pixels after which the span repeats.
+ * \param[in]     len    The length of the span in pixels.
+ */
+static void cgifh_span_repeat(
+		uint8_t *span,
+		size_t period,
+		size_t len)
+{
+	size_t done = (period < len) ? period : len;
+
+	while (done < len) {
+		size_t n = (done < len - done) ? done : len - done;
+
+		memcpy(span + done, span, n);
+		done += n;
+	}
+}
+
+/**
+ * Fill a rectangle with a two colour pattern.
+ *
+ * Each distinct pattern row is rendered once, and subsequent rows with the
+ * same content are copied from it. The rendered rows are read back, so only
+ * the copies may use streaming stores.
+ *
+ * \param[in] img     The image to draw a rectangle in.
+ * \param[in] pattern The pattern to fill with.
+ * \param[in] x       The x coordinate of the top left corner of the rectangle.
+ * \param[in] y       The y coordinate of the top left corner of the rectangle.
+ * \param[in] w       The width of the rectangle.
+ * \param[in] h       The height of the rectangle.
+ */
+static void cgifh_rect_fill_pattern(
+		cgifh_t *img,
+		const cgifh_pattern_t *pattern,
+		int x, int y,
+		int w, int h)
+{
+	const uint8_t *rows[CGIFH_PATTERN_ROWS_MAX] = { NULL };
+	int x0 = x;
+	int y0 = y;
+	int x1 = x + w;
+	int y1 = y + h;
+	size_t period;
+	size_t len;
+	bool stream;
+
+	if (!cgifh_clip_rect(img, &x0, &y0, &x1, &y1)) {
+		return;
+	}
+
+	period = cgifh_pattern_period(pattern);
+	len = (size_t) (x1 - x0);
+	stream = cgifh_span_stream(len * (size_t) (y1 - y0));
+
+	for (int row = y0; row < y1; row++) {
+		int key = cgifh_pattern_row_key(pattern, row);
+		uint8_t *span = cgifh_row(img, row) + x0;
+
+		if (rows[key] != NULL) {
+			cgifh_span_copy(span, rows[key], len, stream);
+			continue;
+		}
+
+		for (size_t i = 0; i < period && i < len; i++) {
+			span[i] = cgifh_pattern_px(pattern, x0 + (int) i, key);
+		}
+		cgifh_span_repeat(span, period, len);
+		rows[key] = span;
+	}
+
+	cgifh_span_fence(stream);
 }
 
 /* Exported function, documented in cgifh.h */
-int cgifh_char_scaled(
+void cgifh_rect_fill_checker(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int cell,
+		int x, int y,
+		int w, int h)
+{
+	const cgifh_pattern_t pattern = {
+		.type = CGIFH_PATTERN_CHECKER,
+		.colour = { colour0, colour1 },
+		.size = (cell < 1) ? 1 : cell,
+	};
+
+	cgifh_rect_fill_pattern(img, &pattern, x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_rect_fill_h_stripes(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int size,
+		int x, int y,
+		int w, int h)
+{
+	const cgifh_pattern_t pattern = {
+		.type = CGIFH_PATTERN_H_STRIPES,
+		.colour = { colour0, colour1 },
+		.size = (size < 1) ? 1 : size,
+	};
+
+	cgifh_rect_fill_pattern(img, &pattern, x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_rect_fill_v_stripes(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		int size,
+		int x, int y,
+		int w, int h)
+{
+	const cgifh_pattern_t pattern = {
+		.type = CGIFH_PATTERN_V_STRIPES,
+		.colour = { colour0, colour1 },
+		.size = (size < 1) ? 1 : size,
+	};
+
+	cgifh_rect_fill_pattern(img, &pattern, x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_rect_fill_dither(
+		cgifh_t *img,
+		uint8_t colour0,
+		uint8_t colour1,
+		uint8_t pos,
+		int x, int y,
+		int w, int h)
+{
+	const cgifh_pattern_t pattern = {
+		.type = CGIFH_PATTERN_DITHER,
+		.colour = { colour0, colour1 },
+		.size = pos,
+	};
+
+	cgifh_rect_fill_pattern(img, &pattern, x, y, w, h);
+}
+
+/**
+ * Fill a rectangle of a glyph, clipped to the image.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to fill with.
+ * \param[in] x0     Left edge.
+ * \param[in] y0     Top edge.
+ * \param[in] x1     Right edge, exclusive.
+ * \param[in] y1     Bottom edge, exclusive.
+ */
+static inline void cgifh_glyph_rect(
 		cgifh_t *img,
 		uint8_t colour,
-		char character,
+		int x0,
+		int y0,
+		int x1,
+		int y1)
+{
+	if (!cgifh_clip_rect(img, &x0, &y0, &x1, &y1)) {
+		return;
+	}
+
+	for (int row = y0; row < y1; row++) {
+		memset(cgifh_row(img, row) + x0, colour, (size_t) (x1 - x0));
+	}
+}
+
+/**
+ * Draw a glyph of the built-in font.
+ *
+ * \param[in] img     Image to draw on.
+ * \param[in] colour  Colour to draw glyph in.
+ * \param[in] glyph   Glyph to draw, or NULL.
+ * \param[in] scale_x Horizontal scale factor.
+ * \param[in] scale_y Vertical scale factor.
+ * \param[in] x       X coordinate to draw glyph at.
+ * \param[in] y       Y coordinate to draw glyph at.
+ * \return The x-advance for the drawn glyph in pixels.
+ */
+static int cgifh_glyph_scaled(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_glyph_t *glyph,
 		int scale_x,
 		int scale_y,
 		int x,
 		int y)
 {
-	const cgifh_glyph_t *glyph = cgifh_get_glyph(character);
-	cgifh_pixel_fn px;
-
-	px = cgifh_get_px_fn(img, x, y,
-			x + glyph->advance * scale_x,
-			y + 8 * scale_y);
-
-	if (glyph == NULL || glyph->advance == 0) {
+	if (glyph == NULL) {
 		return 0;
+	}
 
-	} else if (px == NULL) {
+	if (glyph->span_count == 0 ||
+	    x + glyph->box.x0 * scale_x >= img->clip.x1 ||
+	    x + glyph->box.x1 * scale_x <= img->clip.x0 ||
+	    y + glyph->box.y0 * scale_y >= img->clip.y1 ||
+	    y + glyph->box.y1 * scale_y <= img->clip.y0) {
 		return glyph->advance * scale_x;
 	}
 
-	for (int row = 0; row < CGIFH_GLYPH_HEIGHT; row++) {
-		if (glyph->data[row] != 0) {
-			int xx = x;
-			for (int col = 0; col < CGIFH_GLYPH_WIDTH; col++) {
-				if (glyph->data[row] & (0x80 >> col)) {
-					for (int i = 0; i < scale_y; i++) {
-						for (int j = 0; j < scale_x; j++) {
-							px(img, colour, xx + j, y + i);
-						}
-					}
-				}
-				xx += scale_x;
-			}
-		}
-		y += scale_y;
+	for (unsigned i = 0; i < glyph->span_count; i++) {
+		const cgifh_glyph_span_t *span = &glyph->spans[i];
+
+		cgifh_glyph_rect(img, colour,
+				x + span->x0 * scale_x,
+				y + span->row * scale_y,
+				x + span->x1 * scale_x,
+				y + (span->row + 1) * scale_y);
 	}
 
 	return glyph->advance * scale_x;
 }
 
+/* Exported function, documented in cgifh.h */
+int cgifh_char_scaled(
+		cgifh_t *img,
+		uint8_t colour,
+		char character,
+		int scale_x,
+		int scale_y,
+		int x,
+		int y)
+{
+	return cgifh_glyph_scaled(img, colour, cgifh_get_glyph(character),
+			scale_x, scale_y, x, y);
+}
+
 /* Exported function, documented in cgifh.h */
 int cgifh_char(
 		cgifh_t *img,
@@ -391,15 +827,39 @@ int cgifh_text(
 		int x,
 		int y)
 {
+	int overhang = cgifh_font_builtin.overhang * scale;
 	int advance = 0;
 
+	if (y >= img->clip.y1 || y + cgifh_text_height(scale) <= img->clip.y0) {
+		return cgifh_text_width(text, scale);
+	}
+
+	/* Glyphs end by their advance plus the font's overhang, so those
+	 * left of the clip rectangle are only measured. */
 	while (*text != '\0') {
-		advance += cgifh_char(img, colour, *text,
-				scale, x + advance, y);
-		text++;
+		const char *next = text;
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(
+				&cgifh_font_builtin, cgifh_utf8_next(&next));
+		int glyph_advance = (glyph != NULL) ?
+				glyph->advance * scale : 0;
+
+		if (x + advance + glyph_advance + overhang > img->clip.x0) {
+			break;
+		}
+		advance += glyph_advance;
+		text = next;
 	}
 
-	return advance;
+	/* Glyphs start at or after their pen position, so once the pen is
+	 * past the right edge only the advance is left to measure. */
+	while (*text != '\0' && x + advance < img->clip.x1) {
+		advance += cgifh_glyph_scaled(img, colour,
+				cgifh_font_glyph(&cgifh_font_builtin,
+						cgifh_utf8_next(&text)),
+				scale, scale, x + advance, y);
+	}
+
+	return advance + cgifh_text_width(text, scale);
 }
 
 /* Exported function, documented in cgifh.h */
@@ -408,13 +868,125 @@ int cgifh_text_width(const char *text, int scale)
 	int advance = 0;
 
 	while (*text != '\0') {
-		const cgifh_glyph_t *glyph = cgifh_get_glyph(*text);
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(
+				&cgifh_font_builtin, cgifh_utf8_next(&text));
 
 		if (glyph != NULL) {
-			advance += font_h8[(unsigned char)*text].advance;
+			advance += glyph->advance;
 		}
-		text++;
 	}
 
 	return advance * scale;
 }
+
+/**
+ * Draw a rotated glyph of the built-in font.
+ *
+ * Glyphs rotated by 90 or 270 degrees are drawn from their columns, and
+ * the others from their spans, so each run is a horizontal fill.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw glyph in.
+ * \param[in] glyph  Glyph to draw.
+ * \param[in] scale  Scale factor.
+ * \param[in] rotate Rotation to draw glyph at.
+ * \param[in] x      X coordinate of the rotated text's bounding box.
+ * \param[in] y      Y coordinate of the rotated text's bounding box.
+ * \param[in] width  Unrotated width of the text.
+ * \param[in] pen    Unrotated offset of the glyph along the text.
+ */
+static void cgifh_glyph_rotated(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_glyph_t *glyph,
+		int scale,
+		cgifh_rotate_t rotate,
+		int x,
+		int y,
+		int width,
+		int pen)
+{
+	int height = cgifh_text_height(scale);
+
+	switch (rotate) {
+	case CGIFH_ROTATE_90:
+		for (unsigned i = 0; i < glyph->column_count; i++) {
+			const cgifh_glyph_span_t *col = &glyph->columns[i];
+
+			cgifh_glyph_rect(img, colour,
+					x + height - col->x1 * scale,
+					y + pen + col->row * scale,
+					x + height - col->x0 * scale,
+					y + pen + (col->row + 1) * scale);
+		}
+		break;
+
+	case CGIFH_ROTATE_180:
+		for (unsigned i = 0; i < glyph->span_count; i++) {
+			const cgifh_glyph_span_t *span = &glyph->spans[i];
+
+			cgifh_glyph_rect(img, colour,
+					x + width - pen - span->x1 * scale,
+					y + height - (span->row + 1) * scale,
+					x + width - pen - span->x0 * scale,
+					y + height - span->row * scale);
+		}
+		break;
+
+	case CGIFH_ROTATE_270:
+		for (unsigned i = 0; i < glyph->column_count; i++) {
+			const cgifh_glyph_span_t *col = &glyph->columns[i];
+
+			cgifh_glyph_rect(img, colour,
+					x + col->x0 * scale,
+					y + width - pen - (col->row + 1) * scale,
+					x + col->x1 * scale,
+					y + width - pen - col->row * scale);
+		}
+		break;
+
+	default:
+		cgifh_glyph_scaled(img, colour, glyph, scale, scale,
+				x + pen, y);
+		break;
+	}
+}
+
+/* Exported function, documented in cgifh.h */
+int cgifh_text_rotated(
+		cgifh_t *img,
+		uint8_t colour,
+		const char *text,
+		int scale,
+		cgifh_rotate_t rotate,
+		int x,
+		int y)
+{
+	int width = cgifh_text_width(text, scale);
+	int height = cgifh_text_height(scale);
+	bool vertical = (rotate == CGIFH_ROTATE_90 ||
+	                 rotate == CGIFH_ROTATE_270);
+	int box_w = vertical ? height : width;
+	int box_h = vertical ? width : height;
+	int pen = 0;
+
+	if (x >= img->clip.x1 || x + box_w <= img->clip.x0 ||
+	    y >= img->clip.y1 || y + box_h <= img->clip.y0) {
+		return width;
+	}
+
+	while (*text != '\0') {
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(
+				&cgifh_font_builtin, cgifh_utf8_next(&text));
+
+		if (glyph == NULL || glyph->advance == 0) {
+			continue;
+		}
+
+		cgifh_glyph_rotated(img, colour, glyph, scale, rotate,
+				x, y, width, pen);
+		pen += glyph->advance * scale;
+	}
+
+	return width;
+}
@@ -0,0 +1,184 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Render contexts.
+ *
+ * Working memory is a single block that grows to the largest size asked
+ * for, and is kept until the context is destroyed. Drawing calls rarely
+ * need more than one block at once; when they do, the extra blocks are
+ * allocated and freed as usual.
+ */
+
+#include <stdlib.h>
+
+#include <cgifh.h>
+
+#include "ctx.h"
+
+/**
+ * Standard C allocator allocation function.
+ *
+ * \param[in] pw   Unused.
+ * \param[in] size Number of bytes to allocate.
+ * \return The memory, or NULL on failure.
+ */
+static void *cgifh_ctx_std_alloc(void *pw, size_t size)
+{
+	(void) pw;
+
+	return malloc(size);
+}
+
+/**
+ * Standard C allocator free function.
+ *
+ * \param[in] pw  Unused.
+ * \param[in] ptr The memory to free.
+ */
+static void cgifh_ctx_std_free(void *pw, void *ptr)
+{
+	(void) pw;
+
+	free(ptr);
+}
+
+/* Internal function, documented in ctx.h */
+void *cgifh_ctx_alloc(cgifh_ctx_t *ctx, size_t size)
+{
+	void *ptr;
+
+	if (ctx == NULL) {
+		return malloc(size);
+	}
+
+	ptr = ctx->allocator.alloc(ctx->allocator.pw, size);
+	ctx->stats.allocs++;
+	if (ptr == NULL) {
+		ctx->stats.alloc_failures++;
+	}
+
+	return ptr;
+}
+
+/* Internal function, documented in ctx.h */
+void cgifh_ctx_free(cgifh_ctx_t *ctx, void *ptr)
+{
+	if (ctx == NULL) {
+		free(ptr);
+		return;
+	}
+
+	if (ptr != NULL) {
+		ctx->allocator.free(ctx->allocator.pw, ptr);
+	}
+}
+
+/* Internal function, documented in ctx.h */
+void *cgifh_scratch_alloc(cgifh_t *img, size_t size)
+{
+	cgifh_ctx_t *ctx = img->ctx;
+
+	if (ctx == NULL || ctx->scratch_busy) {
+		return cgifh_ctx_alloc(ctx, size);
+	}
+
+	if (size > ctx->scratch_size) {
+		cgifh_ctx_free(ctx, ctx->scratch);
+		ctx->scratch_size = 0;
+		ctx->scratch = cgifh_ctx_alloc(ctx, size);
+		if (ctx->scratch == NULL) {
+			return NULL;
+		}
+		ctx->scratch_size = size;
+	} else {
+		ctx->stats.scratch_reuses++;
+	}
+
+	ctx->scratch_busy = true;
+	return ctx->scratch;
+}
+
+/* Internal function, documented in ctx.h */
+void cgifh_scratch_free(cgifh_t *img, void *ptr)
+{
+	cgifh_ctx_t *ctx = img->ctx;
+
+	if (ctx != NULL && ptr != NULL && ptr == ctx->scratch) {
+		ctx->scratch_busy = false;
+		return;
+	}
+
+	cgifh_ctx_free(ctx, ptr);
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_ctx_t *cgifh_ctx_create(const cgifh_ctx_config_t *config)
+{
+	static const cgifh_allocator_t std = {
+		.alloc = cgifh_ctx_std_alloc,
+		.free = cgifh_ctx_std_free,
+	};
+	const cgifh_allocator_t *allocator = &std;
+	cgifh_ctx_t *ctx;
+
+	if (config != NULL && config->allocator != NULL) {
+		allocator = config->allocator;
+	}
+
+	ctx = allocator->alloc(allocator->pw, sizeof(*ctx));
+	if (ctx == NULL) {
+		return NULL;
+	}
+
+	*ctx = (cgifh_ctx_t) {
+		.allocator = *allocator,
+		.stats = {
+			.allocs = 1,
+		},
+	};
+
+	if (config != NULL && config->text_cache_capacity > 0) {
+		ctx->text_cache = cgifh_text_cache_create(
+				config->text_cache_capacity);
+		if (ctx->text_cache == NULL) {
+			cgifh_ctx_destroy(ctx);
+			return NULL;
+		}
+	}
+
+	return ctx;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_ctx_destroy(cgifh_ctx_t *ctx)
+{
+	if (ctx == NULL) {
+		return;
+	}
+
+	cgifh_text_cache_destroy(ctx->text_cache);
+	cgifh_ctx_free(ctx, ctx->match);
+	cgifh_ctx_free(ctx, ctx->scratch);
+	ctx->allocator.free(ctx->allocator.pw, ctx);
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_text_cache_t *cgifh_ctx_text_cache(cgifh_ctx_t *ctx)
+{
+	return (ctx != NULL) ? ctx->text_cache : NULL;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_ctx_stats(const cgifh_ctx_t *ctx, cgifh_stats_t *stats)
+{
+	*stats = ctx->stats;
+
+	if (ctx->text_cache != NULL) {
+		cgifh_text_cache_counts(ctx->text_cache,
+				&stats->layout_hits, &stats->layout_misses);
+	}
+}
@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+#ifndef CGIFH_CTX_H
+#define CGIFH_CTX_H
+
+/**
+ * \file Render context internals.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <cgifh.h>
+
+#include "dither.h"
+
+/**
+ * Render context.
+ *
+ * Everything drawing reuses between calls lives here rather than in
+ * global state, so contexts on different threads share nothing.
+ */
+struct cgifh_ctx {
+	cgifh_allocator_t allocator;    /**< Allocator for everything. */
+	cgifh_text_cache_t *text_cache; /**< Text layout cache, or NULL. */
+
+	void *scratch;       /**< Working memory, or NULL. */
+	size_t scratch_size; /**< Size of the working memory in bytes. */
+	bool scratch_busy;   /**< Whether the working memory is in use. */
+
+	/** Palette match cache, or NULL. */
+	cgifh_match_t *match;
+	/** Palette the match cache's entries were found in. */
+	uint8_t match_palette[CGIFH_CHANNEL_COUNT * CGIFH_PALETTE_MAX];
+	/** Number of entries in the match cache's palette. */
+	uint16_t match_palette_count;
+	/** Ordered dither spread of the match cache's palette, or -1 if it
+	 * hasn't been found yet. */
+	int match_spread;
+
+	cgifh_stats_t stats; /**< Statistics. */
+};
+
+/**
+ * Initialise an image's fields.
+ *
+ * The image data must directly follow the image structure.
+ *
+ * \param[in] img    The image to initialise.
+ * \param[in] ctx    The context the image belongs to, or NULL.
+ * \param[in] width  The width of the image in pixels.
+ * \param[in] height The height of the image in pixels.
+ */
+static inline void cgifh_image_init(
+		cgifh_t *img,
+		cgifh_ctx_t *ctx,
+		size_t width,
+		size_t height)
+{
+	img->width = (int) width;
+	img->height = (int) height;
+	img->size = width * height;
+	img->palette_count = 0;
+	img->ctx = ctx;
+	img->clip.x0 = 0;
+	img->clip.y0 = 0;
+	img->clip.x1 = (int) width;
+	img->clip.y1 = (int) height;
+	img->bounds.x0 = 0;
+	img->bounds.y0 = 0;
+	img->bounds.x1 = (int) width;
+	img->bounds.y1 = (int) height;
+	img->group.depth = 0;
+	img->group.culled = 0;
+	img->data = (uint8_t *) (img + 1);
+}
+
+/**
+ * Allocate memory with a context's allocator.
+ *
+ * \param[in] ctx  The context, or NULL for the standard C allocator.
+ * \param[in] size The number of bytes to allocate.
+ * \return The memory, or NULL on failure.
+ */
+void *cgifh_ctx_alloc(cgifh_ctx_t *ctx, size_t size);
+
+/**
+ * Free memory allocated with \ref cgifh_ctx_alloc.
+ *
+ * \param[in] ctx The context the memory was allocated with, or NULL.
+ * \param[in] ptr The memory to free, or NULL.
+ */
+void cgifh_ctx_free(cgifh_ctx_t *ctx, void *ptr);
+
+/**
+ * Get working memory for drawing into an image.
+ *
+ * Images in a context use the context's working memory, which is kept
+ * between calls. If it is already in use, or the image has no context,
+ * the memory is allocated.
+ *
+ * \param[in] img  The image being drawn into.
+ * \param[in] size The number of bytes needed.
+ * \return The memory, suitably aligned for any type, or NULL on failure.
+ */
+void *cgifh_scratch_alloc(cgifh_t *img, size_t size);
+
+/**
+ * Finish with working memory from \ref cgifh_scratch_alloc.
+ *
+ * \param[in] img The image the memory was got for.
+ * \param[in] ptr The memory, or NULL.
+ */
+void cgifh_scratch_free(cgifh_t *img, void *ptr);
+
+/**
+ * Get a text cache's lookup counts.
+ *
+ * \param[in]  cache  The cache.
+ * \param[out] hits   Returns the number of layouts found in the cache.
+ * \param[out] misses Returns the number of layouts not found in the cache.
+ */
+void cgifh_text_cache_counts(
+		const cgifh_text_cache_t *cache,
+		size_t *hits,
+		size_t *misses);
+
+#endif /* CGIFH_CTX_H */
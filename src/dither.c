@@ -0,0 +1,611 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Dithering helpers.
+ *
+ * RGB sources are converted a row at a time. Each source provides its rows
+ * through a callback, so RGB buffers, flat colours and gradients share the
+ * same conversion code.
+ */
+
+#include <string.h>
+
+#include "ctx.h"
+#include "dither.h"
+
+/* Internal data, documented in dither.h */
+const uint8_t cgifh_bayer4[4][4] = {
+	{   8, 136,  40, 168 },
+	{ 200,  72, 232, 104 },
+	{  56, 184,  24, 152 },
+	{ 248, 120, 216,  88 },
+};
+
+/* Internal function, documented in dither.h */
+void cgifh_match_init(cgifh_match_t *match, const cgifh_t *img)
+{
+	match->img = img;
+	for (size_t i = 0; i < CGIFH_MATCH_CACHE_SIZE; i++) {
+		match->key[i] = CGIFH_MATCH_KEY_EMPTY;
+	}
+}
+
+/* Internal function, documented in dither.h */
+uint8_t cgifh_match_search(cgifh_match_t *match, uint32_t key, uint32_t slot)
+{
+	const uint8_t *p = match->img->palette;
+	int r = (int) (key >> 16);
+	int g = (int) (key >> 8 & 0xff);
+	int b = (int) (key & 0xff);
+	int best_dist = INT_MAX;
+	uint8_t best = 0;
+
+	for (int i = 0; i < match->img->palette_count; i++) {
+		int dr = p[0] - r;
+		int dg = p[1] - g;
+		int db = p[2] - b;
+		int dist = dr * dr + dg * dg + db * db;
+
+		if (dist < best_dist) {
+			best_dist = dist;
+			best = (uint8_t) i;
+		}
+		p += CGIFH_CHANNEL_COUNT;
+	}
+
+	match->key[slot] = key;
+	match->index[slot] = best;
+
+	return best;
+}
+
+/**
+ * Callback to get part of a row of RGB source data.
+ *
+ * \param[in] pw    The source's private data.
+ * \param[in] row   The row to get, relative to the top of the source.
+ * \param[in] col   The first column to get, relative to the source's left.
+ * \param[in] count The number of pixels to get.
+ * \param[in] buf   Buffer of count pixels, which the source may render the
+ *                  row into. The same buffer is passed for every row of a
+ *                  conversion, so a source may leave a row in it for reuse.
+ * \return Pointer to the RGB data for the first pixel.
+ */
+typedef const uint8_t *(*cgifh_rgb_row_fn)(
+		void *pw,
+		int row,
+		int col,
+		int count,
+		uint8_t *buf);
+
+/**
+ * Get the ordered dither spread for an image's palette.
+ *
+ * This is the mean distance from each palette entry to its nearest
+ * neighbour, measured as the largest difference in any channel. Dithering
+ * by this much moves colours between neighbouring palette entries, without
+ * adding noise beyond that.
+ *
+ * \param[in] img The image to get the dither spread for.
+ * \return The spread, in channel value units.
+ */
+static int cgifh_dither_spread(const cgifh_t *img)
+{
+	const uint8_t *palette = img->palette;
+	int count = img->palette_count;
+	int total = 0;
+
+	if (count < 2) {
+		return 0;
+	}
+
+	for (int i = 0; i < count; i++) {
+		const uint8_t *p = palette + CGIFH_CHANNEL_COUNT * i;
+		int nearest = INT_MAX;
+
+		for (int j = 0; j < count; j++) {
+			const uint8_t *q = palette + CGIFH_CHANNEL_COUNT * j;
+			int dist = 0;
+
+			for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+				int d = abs(p[c] - q[c]);
+
+				dist = (d > dist) ? d : dist;
+			}
+			if (j != i && dist < nearest) {
+				nearest = dist;
+			}
+		}
+		total += nearest;
+	}
+
+	return total / count;
+}
+
+/**
+ * Clamp a value to the range of a colour channel.
+ *
+ * \param[in] v The value to clamp.
+ * \return The clamped value.
+ */
+static inline uint8_t cgifh_dither_clamp(int v)
+{
+	return (uint8_t) ((v < 0) ? 0 : (v > 255) ? 255 : v);
+}
+
+/**
+ * Convert rows of RGB source data without error diffusion.
+ *
+ * Only the rows and columns within the clip rectangle are converted.
+ *
+ * \param[in] img    The image to draw into.
+ * \param[in] match  Palette match cache for the image.
+ * \param[in] spread Ordered dither spread, or zero for no dithering.
+ * \param[in] row_fn Callback to get rows of source data.
+ * \param[in] pw     The source's private data.
+ * \param[in] buf    Row buffer of x1 - x0 pixels for the source.
+ * \param[in] x      The x coordinate of the source's left edge.
+ * \param[in] y      The y coordinate of the source's top edge.
+ * \param[in] x0     The left edge of the clip rectangle.
+ * \param[in] y0     The top edge of the clip rectangle.
+ * \param[in] x1     The right edge of the clip rectangle (exclusive).
+ * \param[in] y1     The bottom edge of the clip rectangle (exclusive).
+ */
+static void cgifh_dither_ordered(
+		cgifh_t *img,
+		cgifh_match_t *match,
+		int spread,
+		cgifh_rgb_row_fn row_fn,
+		void *pw,
+		uint8_t *buf,
+		int x, int y,
+		int x0, int y0,
+		int x1, int y1)
+{
+	int col0 = (int) ((int64_t) x0 - x);
+
+	for (int row = y0; row < y1; row++) {
+		const uint8_t *src = row_fn(pw, (int) ((int64_t) row - y),
+				col0, x1 - x0, buf);
+		uint8_t *dst = cgifh_row(img, row);
+
+		for (int col = x0; col < x1; col++) {
+			int offset = (cgifh_dither_threshold(col, row) - 128) *
+					spread / 256;
+
+			dst[col] = cgifh_match_rgb(match,
+					cgifh_dither_clamp(src[0] + offset),
+					cgifh_dither_clamp(src[1] + offset),
+					cgifh_dither_clamp(src[2] + offset));
+			src += CGIFH_CHANNEL_COUNT;
+		}
+	}
+}
+
+/**
+ * Convert rows of RGB source data with Floyd-Steinberg error diffusion.
+ *
+ * Error diffusion depends on every pixel above and to the side, so all of
+ * the source's columns, and all of its rows down to the bottom of the clip
+ * rectangle, are processed. Only pixels within the clip rectangle are
+ * written.
+ *
+ * Rows are processed in alternating directions to avoid the diagonal
+ * artefacts that arise from always diffusing error the same way.
+ *
+ * \param[in] img    The image to draw into.
+ * \param[in] match  Palette match cache for the image.
+ * \param[in] errors Error buffer for two rows of w + 2 pixels.
+ * \param[in] row_fn Callback to get rows of source data.
+ * \param[in] pw     The source's private data.
+ * \param[in] buf    Row buffer of w pixels for the source.
+ * \param[in] x      The x coordinate of the source's left edge.
+ * \param[in] y      The y coordinate of the source's top edge.
+ * \param[in] w      The width of the source.
+ * \param[in] x0     The left edge of the clip rectangle.
+ * \param[in] y0     The top edge of the clip rectangle.
+ * \param[in] x1     The right edge of the clip rectangle (exclusive).
+ * \param[in] y1     The bottom edge of the clip rectangle (exclusive).
+ */
+static void cgifh_dither_floyd_steinberg(
+		cgifh_t *img,
+		cgifh_match_t *match,
+		int *errors,
+		cgifh_rgb_row_fn row_fn,
+		void *pw,
+		uint8_t *buf,
+		int x, int y, int w,
+		int x0, int y0,
+		int x1, int y1)
+{
+	enum { C = CGIFH_CHANNEL_COUNT };
+	size_t row_len = ((size_t) w + 2) * C;
+	int *cur = errors + C;
+	int *next = errors + row_len + C;
+
+	memset(errors, 0, 2 * row_len * sizeof(*errors));
+
+	for (int row = y; row < y1; row++) {
+		const uint8_t *src = row_fn(pw, (int) ((int64_t) row - y),
+				0, w, buf);
+		bool visible = (row >= y0);
+		int dir = ((row - y) & 1) ? -1 : 1;
+		int *tmp;
+
+		memset(next - C, 0, row_len * sizeof(*next));
+
+		for (int k = 0; k < w; k++) {
+			int i = (dir > 0) ? k : w - 1 - k;
+			const uint8_t *s = src + (size_t) i * C;
+			const uint8_t *p;
+			uint8_t v[C];
+			uint8_t idx;
+
+			for (int c = 0; c < C; c++) {
+				v[c] = cgifh_dither_clamp(s[c] +
+						cur[i * C + c] / 16);
+			}
+
+			idx = cgifh_match_rgb(match, v[0], v[1], v[2]);
+			if (visible && (int64_t) x + i >= x0 &&
+			    (int64_t) x + i < x1) {
+				cgifh_pixel(img, idx, x + i, row);
+			}
+
+			p = img->palette + C * idx;
+			for (int c = 0; c < C; c++) {
+				int e = v[c] - p[c];
+
+				cur[(i + dir) * C + c] += e * 7;
+				next[(i - dir) * C + c] += e * 3;
+				next[i * C + c] += e * 5;
+				next[(i + dir) * C + c] += e;
+			}
+		}
+
+		tmp = cur;
+		cur = next;
+		next = tmp;
+	}
+}
+
+/**
+ * Get a palette match cache for an image.
+ *
+ * Images in a render context use the context's cache, which keeps its
+ * entries for as long as the palette it is used with is unchanged.
+ *
+ * \param[in] img The image whose palette to match against.
+ * \return The cache, or NULL on memory allocation failure.
+ */
+static cgifh_match_t *cgifh_dither_match(cgifh_t *img)
+{
+	size_t palette_size = (size_t) img->palette_count * CGIFH_CHANNEL_COUNT;
+	cgifh_ctx_t *ctx = img->ctx;
+	cgifh_match_t *match;
+
+	if (ctx == NULL) {
+		match = malloc(sizeof(*match));
+		if (match != NULL) {
+			cgifh_match_init(match, img);
+		}
+		return match;
+	}
+
+	if (ctx->match == NULL) {
+		ctx->match = cgifh_ctx_alloc(ctx, sizeof(*ctx->match));
+		if (ctx->match == NULL) {
+			return NULL;
+		}
+
+	} else if (ctx->match_palette_count == img->palette_count &&
+	           memcmp(ctx->match_palette, img->palette,
+				palette_size) == 0) {
+		ctx->match->img = img;
+		return ctx->match;
+	}
+
+	cgifh_match_init(ctx->match, img);
+	memcpy(ctx->match_palette, img->palette, palette_size);
+	ctx->match_palette_count = img->palette_count;
+	ctx->match_spread = -1;
+	return ctx->match;
+}
+
+/**
+ * Get the ordered dither spread for a palette match cache's palette.
+ *
+ * Finding the spread compares every pair of palette entries, so images in a
+ * render context keep it with the context's match cache.
+ *
+ * \param[in] img   The image being drawn into.
+ * \param[in] match The image's cache, from \ref cgifh_dither_match.
+ * \return The spread, in channel value units.
+ */
+static int cgifh_dither_match_spread(cgifh_t *img, cgifh_match_t *match)
+{
+	cgifh_ctx_t *ctx = img->ctx;
+
+	if (ctx == NULL || ctx->match != match) {
+		return cgifh_dither_spread(img);
+	}
+
+	if (ctx->match_spread < 0) {
+		ctx->match_spread = cgifh_dither_spread(img);
+	}
+
+	return ctx->match_spread;
+}
+
+/**
+ * Finish with a palette match cache from \ref cgifh_dither_match.
+ *
+ * \param[in] img   The image the cache was got for.
+ * \param[in] match The cache, or NULL.
+ */
+static void cgifh_dither_match_free(cgifh_t *img, cgifh_match_t *match)
+{
+	if (img->ctx == NULL) {
+		free(match);
+	}
+}
+
+/**
+ * Draw RGB source data into an image, converting it to palette indexes.
+ *
+ * \param[in] img    The image to draw into.
+ * \param[in] dither The dithering mode.
+ * \param[in] row_fn Callback to get rows of source data.
+ * \param[in] pw     The source's private data.
+ * \param[in] x      The x coordinate of the source's left edge.
+ * \param[in] y      The y coordinate of the source's top edge.
+ * \param[in] w      The width of the source.
+ * \param[in] h      The height of the source.
+ * \return true on success, false on memory allocation failure or if the
+ *         palette is empty.
+ */
+static bool cgifh_dither_rect(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		cgifh_rgb_row_fn row_fn,
+		void *pw,
+		int x, int y,
+		int w, int h)
+{
+	int64_t right = (int64_t) x + w;
+	int64_t bottom = (int64_t) y + h;
+	int x0 = (x < img->clip.x0) ? img->clip.x0 : x;
+	int y0 = (y < img->clip.y0) ? img->clip.y0 : y;
+	int x1 = (right > img->clip.x1) ? img->clip.x1 : (int) right;
+	int y1 = (bottom > img->clip.y1) ? img->clip.y1 : (int) bottom;
+	size_t errors_size = 0;
+	size_t buf_width;
+	cgifh_match_t *match;
+	int *errors = NULL;
+	uint8_t *buf;
+	void *scratch;
+
+	if (img->palette_count == 0) {
+		return false;
+	}
+
+	if (w <= 0 || h <= 0 || x0 >= x1 || y0 >= y1) {
+		return true;
+	}
+
+	if (dither == CGIFH_DITHER_FLOYD_STEINBERG) {
+		/* Error diffusion needs whole rows of the source. */
+		errors_size = 2 * ((size_t) w + 2) * CGIFH_CHANNEL_COUNT *
+				sizeof(*errors);
+		buf_width = (size_t) w;
+	} else {
+		buf_width = (size_t) (x1 - x0);
+	}
+	scratch = cgifh_scratch_alloc(img, errors_size +
+			buf_width * CGIFH_CHANNEL_COUNT);
+	match = cgifh_dither_match(img);
+	if (scratch == NULL || match == NULL) {
+		cgifh_dither_match_free(img, match);
+		cgifh_scratch_free(img, scratch);
+		return false;
+	}
+	if (errors_size != 0) {
+		errors = scratch;
+	}
+	buf = (uint8_t *) scratch + errors_size;
+
+	switch (dither) {
+	case CGIFH_DITHER_NONE:
+		cgifh_dither_ordered(img, match, 0, row_fn, pw, buf,
+				x, y, x0, y0, x1, y1);
+		break;
+
+	case CGIFH_DITHER_ORDERED:
+		cgifh_dither_ordered(img, match,
+				cgifh_dither_match_spread(img, match),
+				row_fn, pw, buf, x, y, x0, y0, x1, y1);
+		break;
+
+	case CGIFH_DITHER_FLOYD_STEINBERG:
+		cgifh_dither_floyd_steinberg(img, match, errors, row_fn, pw,
+				buf, x, y, w, x0, y0, x1, y1);
+		break;
+	}
+
+	cgifh_dither_match_free(img, match);
+	cgifh_scratch_free(img, scratch);
+	return true;
+}
+
+/**
+ * RGB buffer source.
+ */
+typedef struct cgifh_rgb_buffer {
+	const uint8_t *rgb; /**< RGB pixel data. */
+	size_t stride;      /**< Bytes from the start of one row to the next. */
+} cgifh_rgb_buffer_t;
+
+/**
+ * Get a row of an RGB buffer source.
+ *
+ * Implements \ref cgifh_rgb_row_fn.
+ *
+ * \param[in] pw    The \ref cgifh_rgb_buffer_t.
+ * \param[in] row   The row to get.
+ * \param[in] col   The first column to get.
+ * \param[in] count Unused.
+ * \param[in] buf   Unused.
+ * \return Pointer to the first pixel in the buffer.
+ */
+static const uint8_t *cgifh_rgb_buffer_row(
+		void *pw,
+		int row,
+		int col,
+		int count,
+		uint8_t *buf)
+{
+	const cgifh_rgb_buffer_t *src = pw;
+
+	(void) count;
+	(void) buf;
+
+	return src->rgb + (size_t) row * src->stride +
+			(size_t) col * CGIFH_CHANNEL_COUNT;
+}
+
+/**
+ * RGB gradient source.
+ */
+typedef struct cgifh_rgb_gradient {
+	const uint8_t *rgb0; /**< Colour at the start of the gradient. */
+	const uint8_t *rgb1; /**< Colour at the end of the gradient. */
+	bool vertical;       /**< Whether the gradient runs top to bottom. */
+	bool rendered;       /**< Whether a horizontal gradient's row is in
+	                      *   the row buffer. */
+	int w;               /**< Width of the gradient in pixels. */
+	int h;               /**< Height of the gradient in pixels. */
+} cgifh_rgb_gradient_t;
+
+/**
+ * Interpolate between two colours.
+ *
+ * \param[in]  rgb0 The colour at the start.
+ * \param[in]  rgb1 The colour at the end.
+ * \param[in]  pos  The position, from 0 to len - 1.
+ * \param[in]  len  The number of positions.
+ * \param[out] out  Returns the interpolated colour.
+ */
+static inline void cgifh_rgb_lerp(
+		const uint8_t *rgb0,
+		const uint8_t *rgb1,
+		int pos,
+		int len,
+		uint8_t *out)
+{
+	for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+		out[c] = (len > 1) ? (uint8_t) (rgb0[c] +
+				(int64_t) (rgb1[c] - rgb0[c]) * pos /
+				(len - 1)) : rgb0[c];
+	}
+}
+
+/**
+ * Get a row of an RGB gradient source.
+ *
+ * Implements \ref cgifh_rgb_row_fn.
+ *
+ * Every row of a horizontal gradient is the same, so it is only rendered
+ * for the first row asked for.
+ *
+ * \param[in] pw    The \ref cgifh_rgb_gradient_t.
+ * \param[in] row   The row to get.
+ * \param[in] col   The first column to get.
+ * \param[in] count The number of pixels to get.
+ * \param[in] buf   Buffer to render the row into.
+ * \return Pointer to the row in buf.
+ */
+static const uint8_t *cgifh_rgb_gradient_row(
+		void *pw,
+		int row,
+		int col,
+		int count,
+		uint8_t *buf)
+{
+	cgifh_rgb_gradient_t *src = pw;
+
+	if (src->vertical) {
+		cgifh_rgb_lerp(src->rgb0, src->rgb1, row, src->h, buf);
+		for (int i = 1; i < count; i++) {
+			memcpy(buf + (size_t) i * CGIFH_CHANNEL_COUNT, buf,
+					CGIFH_CHANNEL_COUNT);
+		}
+	} else if (!src->rendered) {
+		for (int i = 0; i < count; i++) {
+			cgifh_rgb_lerp(src->rgb0, src->rgb1, col + i, src->w,
+					buf + (size_t) i * CGIFH_CHANNEL_COUNT);
+		}
+		src->rendered = true;
+	}
+
+	return buf;
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_rgb_to_index(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		const uint8_t *rgb,
+		size_t stride,
+		int x, int y,
+		int w, int h)
+{
+	cgifh_rgb_buffer_t src = {
+		.rgb = rgb,
+		.stride = stride,
+	};
+
+	return cgifh_dither_rect(img, dither, cgifh_rgb_buffer_row, &src,
+			x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_rect_fill_rgb(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		uint8_t r,
+		uint8_t g,
+		uint8_t b,
+		int x, int y,
+		int w, int h)
+{
+	const uint8_t rgb[CGIFH_CHANNEL_COUNT] = { r, g, b };
+
+	return cgifh_rect_fill_gradient(img, dither, rgb, rgb, false,
+			x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_rect_fill_gradient(
+		cgifh_t *img,
+		cgifh_dither_t dither,
+		const uint8_t rgb0[CGIFH_CHANNEL_COUNT],
+		const uint8_t rgb1[CGIFH_CHANNEL_COUNT],
+		bool vertical,
+		int x, int y,
+		int w, int h)
+{
+	cgifh_rgb_gradient_t src = {
+		.rgb0 = rgb0,
+		.rgb1 = rgb1,
+		.vertical = vertical,
+		.w = w,
+		.h = h,
+	};
+
+	return cgifh_dither_rect(img, dither, cgifh_rgb_gradient_row, &src,
+			x, y, w, h);
+}
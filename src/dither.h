@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+#ifndef CGIFH_DITHER_H
+#define CGIFH_DITHER_H
+
+/**
+ * \file Dithering helpers.
+ */
+
+#include <stdint.h>
+
+#include <cgifh.h>
+
+/**
+ * 4x4 Bayer matrix, scaled to thresholds in the range 0..255.
+ */
+extern const uint8_t cgifh_bayer4[4][4];
+
+/**
+ * Get the ordered dither threshold for a pixel.
+ *
+ * The matrix is anchored to the image origin, so that separately drawn
+ * areas line up.
+ *
+ * \param[in] x The x coordinate of the pixel in the image.
+ * \param[in] y The y coordinate of the pixel in the image.
+ * \return The threshold, in the range 0..255.
+ */
+static inline uint8_t cgifh_dither_threshold(int x, int y)
+{
+	return cgifh_bayer4[y & 3][x & 3];
+}
+
+/** Number of entries in a palette match cache; must be a power of two. */
+#define CGIFH_MATCH_CACHE_SIZE 4096
+
+/** Palette match cache key for empty entries; real keys are 24-bit. */
+#define CGIFH_MATCH_KEY_EMPTY UINT32_MAX
+
+/**
+ * Palette match cache.
+ *
+ * Finds the nearest palette entry to RGB colours, remembering recent
+ * results in a direct mapped cache.
+ */
+typedef struct cgifh_match {
+	const cgifh_t *img; /**< Image whose palette is matched against. */
+	uint32_t key[CGIFH_MATCH_CACHE_SIZE];  /**< Cached RGB colours. */
+	uint8_t index[CGIFH_MATCH_CACHE_SIZE]; /**< Cached palette indexes. */
+} cgifh_match_t;
+
+/**
+ * Initialise a palette match cache.
+ *
+ * \param[out] match The cache to initialise.
+ * \param[in]  img   The image whose palette to match against.
+ */
+void cgifh_match_init(cgifh_match_t *match, const cgifh_t *img);
+
+/**
+ * Find the nearest palette entry to a colour and add it to the cache.
+ *
+ * \param[in] match The palette match cache.
+ * \param[in] key   The RGB colour, as 0xRRGGBB.
+ * \param[in] slot  The cache slot for the colour.
+ * \return The palette index of the nearest colour.
+ */
+uint8_t cgifh_match_search(cgifh_match_t *match, uint32_t key, uint32_t slot);
+
+/**
+ * Find the nearest palette entry to a colour.
+ *
+ * \param[in] match The palette match cache.
+ * \param[in] r     Red component of the colour.
+ * \param[in] g     Green component of the colour.
+ * \param[in] b     Blue component of the colour.
+ * \return The palette index of the nearest colour.
+ */
+static inline uint8_t cgifh_match_rgb(
+		cgifh_match_t *match,
+		uint8_t r,
+		uint8_t g,
+		uint8_t b)
+{
+	uint32_t key = (uint32_t) r << 16 | (uint32_t) g << 8 | b;
+	uint32_t slot = (key * 2654435761U) >> 20 &
+			(CGIFH_MATCH_CACHE_SIZE - 1);
+
+	if (match->key[slot] == key) {
+		return match->index[slot];
+	}
+
+	return cgifh_match_search(match, key, slot);
+}
+
+#endif /* CGIFH_DITHER_H */
@@ -6,6 +6,10 @@
 
 /**
  * \file Simple bitmap font.
+ *
+ * Covers printable ASCII and Latin-1. Capitals and digits are six pixels
+ * high, from the top row, and descenders use the bottom two rows. Accents
+ * use the top row, so accented capitals are one row shorter.
  */
 
 #include "bits.h"
@@ -14,7 +18,7 @@
 /**
  * Bitmap font data.
  */
-const cgifh_glyph_t font_h8[CGIFH_GLYPH_COUNT] = {
+const cgifh_glyph_bitmap_t font_h8[CGIFH_GLYPH_COUNT] = {
 	['a'] = {
 		.advance = 5,
 		.data = {
@@ -1041,4 +1045,1460 @@ const cgifh_glyph_t font_h8[CGIFH_GLYPH_COUNT] = {
 			________,
 		},
 	},
+	['#'] = {
+		.advance = 6,
+		.data = {
+			_S_S____,
+			SSSSS___,
+			_S_S____,
+			_S_S____,
+			SSSSS___,
+			_S_S____,
+			________,
+			________,
+		},
+	},
+	['$'] = {
+		.advance = 6,
+		.data = {
+			__S_____,
+			_SSSS___,
+			S_S_____,
+			_SSS____,
+			__S_S___,
+			SSSS____,
+			__S_____,
+			________,
+		},
+	},
+	['%'] = {
+		.advance = 6,
+		.data = {
+			SS__S___,
+			SS_S____,
+			__S_____,
+			__S_____,
+			_S_SS___,
+			S__SS___,
+			________,
+			________,
+		},
+	},
+	['&'] = {
+		.advance = 6,
+		.data = {
+			_SS_____,
+			S__S____,
+			_SS_____,
+			S_S_S___,
+			S__S____,
+			_SS_S___,
+			________,
+			________,
+		},
+	},
+	['\''] = {
+		.advance = 2,
+		.data = {
+			S_______,
+			S_______,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	['*'] = {
+		.advance = 6,
+		.data = {
+			__S_____,
+			S_S_S___,
+			_SSS____,
+			S_S_S___,
+			__S_____,
+			________,
+			________,
+			________,
+		},
+	},
+	['/'] = {
+		.advance = 5,
+		.data = {
+			___S____,
+			___S____,
+			__S_____,
+			_S______,
+			S_______,
+			S_______,
+			________,
+			________,
+		},
+	},
+	['<'] = {
+		.advance = 5,
+		.data = {
+			________,
+			___S____,
+			_SS_____,
+			S_______,
+			_SS_____,
+			___S____,
+			________,
+			________,
+		},
+	},
+	['='] = {
+		.advance = 5,
+		.data = {
+			________,
+			________,
+			SSSS____,
+			________,
+			SSSS____,
+			________,
+			________,
+			________,
+		},
+	},
+	['>'] = {
+		.advance = 5,
+		.data = {
+			________,
+			S_______,
+			_SS_____,
+			___S____,
+			_SS_____,
+			S_______,
+			________,
+			________,
+		},
+	},
+	['@'] = {
+		.advance = 6,
+		.data = {
+			_SSS____,
+			S___S___,
+			S_SSS___,
+			S_S_S___,
+			S_SSS___,
+			S_______,
+			_SSSS___,
+			________,
+		},
+	},
+	['\\'] = {
+		.advance = 5,
+		.data = {
+			S_______,
+			S_______,
+			_S______,
+			__S_____,
+			___S____,
+			___S____,
+			________,
+			________,
+		},
+	},
+	['^'] = {
+		.advance = 6,
+		.data = {
+			__S_____,
+			_S_S____,
+			S___S___,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	['`'] = {
+		.advance = 3,
+		.data = {
+			S_______,
+			_S______,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	['|'] = {
+		.advance = 2,
+		.data = {
+			S_______,
+			S_______,
+			S_______,
+			S_______,
+			S_______,
+			S_______,
+			S_______,
+			________,
+		},
+	},
+	['~'] = {
+		.advance = 6,
+		.data = {
+			________,
+			________,
+			_SS_S___,
+			S_SS____,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xa0] = { /* U+00A0 NO-BREAK SPACE */
+		.advance = 3,
+		.data = {
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xa1] = { /* U+00A1 INVERTED EXCLAMATION MARK */
+		.advance = 2,
+		.data = {
+			S_______,
+			________,
+			S_______,
+			S_______,
+			S_______,
+			S_______,
+			________,
+			________,
+		},
+	},
+	[0xa2] = { /* U+00A2 CENT SIGN */
+		.advance = 5,
+		.data = {
+			__S_____,
+			_SSS____,
+			S_S_____,
+			S_S_____,
+			_SSS____,
+			__S_____,
+			________,
+			________,
+		},
+	},
+	[0xa3] = { /* U+00A3 POUND SIGN */
+		.advance = 6,
+		.data = {
+			__SS____,
+			_S__S___,
+			SSS_____,
+			_S______,
+			_S______,
+			SSSSS___,
+			________,
+			________,
+		},
+	},
+	[0xa4] = { /* U+00A4 CURRENCY SIGN */
+		.advance = 6,
+		.data = {
+			________,
+			S___S___,
+			_SSS____,
+			_S_S____,
+			_SSS____,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xa5] = { /* U+00A5 YEN SIGN */
+		.advance = 6,
+		.data = {
+			S___S___,
+			_S_S____,
+			SSSSS___,
+			__S_____,
+			SSSSS___,
+			__S_____,
+			________,
+			________,
+		},
+	},
+	[0xa6] = { /* U+00A6 BROKEN BAR */
+		.advance = 2,
+		.data = {
+			S_______,
+			S_______,
+			S_______,
+			________,
+			S_______,
+			S_______,
+			S_______,
+			________,
+		},
+	},
+	[0xa7] = { /* U+00A7 SECTION SIGN */
+		.advance = 5,
+		.data = {
+			_SSS____,
+			S_______,
+			_SS_____,
+			S__S____,
+			_SS_____,
+			___S____,
+			SSS_____,
+			________,
+		},
+	},
+	[0xa8] = { /* U+00A8 DIAERESIS */
+		.advance = 4,
+		.data = {
+			S_S_____,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xa9] = { /* U+00A9 COPYRIGHT SIGN */
+		.advance = 8,
+		.data = {
+			_SSSSS__,
+			S_____S_,
+			S__SS_S_,
+			S_S___S_,
+			S__SS_S_,
+			S_____S_,
+			_SSSSS__,
+			________,
+		},
+	},
+	[0xaa] = { /* U+00AA FEMININE ORDINAL INDICATOR */
+		.advance = 4,
+		.data = {
+			_SS_____,
+			S_S_____,
+			_SS_____,
+			________,
+			SSS_____,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xab] = { /* U+00AB LEFT-POINTING DOUBLE ANGLE QUOTATION MARK */
+		.advance = 5,
+		.data = {
+			________,
+			________,
+			_S_S____,
+			S_S_____,
+			_S_S____,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xac] = { /* U+00AC NOT SIGN */
+		.advance = 5,
+		.data = {
+			________,
+			________,
+			SSSS____,
+			___S____,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xad] = { /* U+00AD SOFT HYPHEN */
+		.advance = 4,
+		.data = {
+			________,
+			________,
+			________,
+			SSS_____,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xae] = { /* U+00AE REGISTERED SIGN */
+		.advance = 8,
+		.data = {
+			_SSSSS__,
+			S_____S_,
+			S_SS__S_,
+			S_S_S_S_,
+			S_SS__S_,
+			S_S_S_S_,
+			_SSSSS__,
+			________,
+		},
+	},
+	[0xaf] = { /* U+00AF MACRON */
+		.advance = 5,
+		.data = {
+			SSSS____,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb0] = { /* U+00B0 DEGREE SIGN */
+		.advance = 4,
+		.data = {
+			_S______,
+			S_S_____,
+			_S______,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb1] = { /* U+00B1 PLUS-MINUS SIGN */
+		.advance = 4,
+		.data = {
+			________,
+			_S______,
+			SSS_____,
+			_S______,
+			________,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xb2] = { /* U+00B2 SUPERSCRIPT TWO */
+		.advance = 4,
+		.data = {
+			SS______,
+			__S_____,
+			_S______,
+			SSS_____,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb3] = { /* U+00B3 SUPERSCRIPT THREE */
+		.advance = 4,
+		.data = {
+			SSS_____,
+			_S______,
+			__S_____,
+			SS______,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb4] = { /* U+00B4 ACUTE ACCENT */
+		.advance = 3,
+		.data = {
+			_S______,
+			S_______,
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb5] = { /* U+00B5 MICRO SIGN */
+		.advance = 5,
+		.data = {
+			________,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			SSS_____,
+			S_______,
+			________,
+		},
+	},
+	[0xb6] = { /* U+00B6 PILCROW SIGN */
+		.advance = 6,
+		.data = {
+			_SSSS___,
+			SSS_S___,
+			SSS_S___,
+			_SS_S___,
+			__S_S___,
+			__S_S___,
+			________,
+			________,
+		},
+	},
+	[0xb7] = { /* U+00B7 MIDDLE DOT */
+		.advance = 2,
+		.data = {
+			________,
+			________,
+			________,
+			S_______,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xb8] = { /* U+00B8 CEDILLA */
+		.advance = 3,
+		.data = {
+			________,
+			________,
+			________,
+			________,
+			________,
+			________,
+			_S______,
+			S_______,
+		},
+	},
+	[0xb9] = { /* U+00B9 SUPERSCRIPT ONE */
+		.advance = 4,
+		.data = {
+			_S______,
+			SS______,
+			_S______,
+			SSS_____,
+			________,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xba] = { /* U+00BA MASCULINE ORDINAL INDICATOR */
+		.advance = 4,
+		.data = {
+			_S______,
+			S_S_____,
+			_S______,
+			________,
+			SSS_____,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xbb] = { /* U+00BB RIGHT-POINTING DOUBLE ANGLE QUOTATION MARK */
+		.advance = 5,
+		.data = {
+			________,
+			________,
+			S_S_____,
+			_S_S____,
+			S_S_____,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xbc] = { /* U+00BC VULGAR FRACTION ONE QUARTER */
+		.advance = 7,
+		.data = {
+			S___S___,
+			S__S____,
+			S_S_____,
+			_S_S_S__,
+			S__SSS__,
+			_____S__,
+			________,
+			________,
+		},
+	},
+	[0xbd] = { /* U+00BD VULGAR FRACTION ONE HALF */
+		.advance = 6,
+		.data = {
+			S___S___,
+			S__S____,
+			S_S_____,
+			_S_SS___,
+			S___S___,
+			___S____,
+			___SS___,
+			________,
+		},
+	},
+	[0xbe] = { /* U+00BE VULGAR FRACTION THREE QUARTERS */
+		.advance = 7,
+		.data = {
+			SS__S___,
+			_S_S____,
+			SSS_____,
+			_S_S_S__,
+			S__SSS__,
+			_____S__,
+			________,
+			________,
+		},
+	},
+	[0xbf] = { /* U+00BF INVERTED QUESTION MARK */
+		.advance = 6,
+		.data = {
+			__S_____,
+			________,
+			__S_____,
+			_S______,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xc0] = { /* U+00C0 LATIN CAPITAL LETTER A WITH GRAVE */
+		.advance = 6,
+		.data = {
+			_S______,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc1] = { /* U+00C1 LATIN CAPITAL LETTER A WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc2] = { /* U+00C2 LATIN CAPITAL LETTER A WITH CIRCUMFLEX */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc3] = { /* U+00C3 LATIN CAPITAL LETTER A WITH TILDE */
+		.advance = 6,
+		.data = {
+			_SS_S___,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc4] = { /* U+00C4 LATIN CAPITAL LETTER A WITH DIAERESIS */
+		.advance = 6,
+		.data = {
+			_S_S____,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc5] = { /* U+00C5 LATIN CAPITAL LETTER A WITH RING ABOVE */
+		.advance = 6,
+		.data = {
+			__S_____,
+			__S_____,
+			_S_S____,
+			S___S___,
+			SSSSS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xc6] = { /* U+00C6 LATIN CAPITAL LETTER AE */
+		.advance = 8,
+		.data = {
+			__SSSSS_,
+			_S_S____,
+			S__SSSS_,
+			SSSSS___,
+			S__S____,
+			S__SSSS_,
+			________,
+			________,
+		},
+	},
+	[0xc7] = { /* U+00C7 LATIN CAPITAL LETTER C WITH CEDILLA */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			S___S___,
+			S_______,
+			S_______,
+			S___S___,
+			_SSS____,
+			__S_____,
+			_S______,
+		},
+	},
+	[0xc8] = { /* U+00C8 LATIN CAPITAL LETTER E WITH GRAVE */
+		.advance = 6,
+		.data = {
+			_S______,
+			SSSSS___,
+			S_______,
+			SSSS____,
+			S_______,
+			SSSSS___,
+			________,
+			________,
+		},
+	},
+	[0xc9] = { /* U+00C9 LATIN CAPITAL LETTER E WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			SSSSS___,
+			S_______,
+			SSSS____,
+			S_______,
+			SSSSS___,
+			________,
+			________,
+		},
+	},
+	[0xca] = { /* U+00CA LATIN CAPITAL LETTER E WITH CIRCUMFLEX */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			SSSSS___,
+			S_______,
+			SSSS____,
+			S_______,
+			SSSSS___,
+			________,
+			________,
+		},
+	},
+	[0xcb] = { /* U+00CB LATIN CAPITAL LETTER E WITH DIAERESIS */
+		.advance = 6,
+		.data = {
+			_S_S____,
+			SSSSS___,
+			S_______,
+			SSSS____,
+			S_______,
+			SSSSS___,
+			________,
+			________,
+		},
+	},
+	[0xcc] = { /* U+00CC LATIN CAPITAL LETTER I WITH GRAVE */
+		.advance = 4,
+		.data = {
+			S_______,
+			SSS_____,
+			_S______,
+			_S______,
+			_S______,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xcd] = { /* U+00CD LATIN CAPITAL LETTER I WITH ACUTE */
+		.advance = 4,
+		.data = {
+			__S_____,
+			SSS_____,
+			_S______,
+			_S______,
+			_S______,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xce] = { /* U+00CE LATIN CAPITAL LETTER I WITH CIRCUMFLEX */
+		.advance = 4,
+		.data = {
+			SSS_____,
+			SSS_____,
+			_S______,
+			_S______,
+			_S______,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xcf] = { /* U+00CF LATIN CAPITAL LETTER I WITH DIAERESIS */
+		.advance = 4,
+		.data = {
+			S_S_____,
+			SSS_____,
+			_S______,
+			_S______,
+			_S______,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xd0] = { /* U+00D0 LATIN CAPITAL LETTER ETH */
+		.advance = 7,
+		.data = {
+			_SSSS___,
+			_S___S__,
+			SSS__S__,
+			_S___S__,
+			_S___S__,
+			_SSSS___,
+			________,
+			________,
+		},
+	},
+	[0xd1] = { /* U+00D1 LATIN CAPITAL LETTER N WITH TILDE */
+		.advance = 6,
+		.data = {
+			_SS_S___,
+			S___S___,
+			SS__S___,
+			S_S_S___,
+			S__SS___,
+			S___S___,
+			________,
+			________,
+		},
+	},
+	[0xd2] = { /* U+00D2 LATIN CAPITAL LETTER O WITH GRAVE */
+		.advance = 6,
+		.data = {
+			_S______,
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd3] = { /* U+00D3 LATIN CAPITAL LETTER O WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd4] = { /* U+00D4 LATIN CAPITAL LETTER O WITH CIRCUMFLEX */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd5] = { /* U+00D5 LATIN CAPITAL LETTER O WITH TILDE */
+		.advance = 6,
+		.data = {
+			_SS_S___,
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd6] = { /* U+00D6 LATIN CAPITAL LETTER O WITH DIAERESIS */
+		.advance = 6,
+		.data = {
+			_S_S____,
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd7] = { /* U+00D7 MULTIPLICATION SIGN */
+		.advance = 4,
+		.data = {
+			________,
+			________,
+			S_S_____,
+			_S______,
+			S_S_____,
+			________,
+			________,
+			________,
+		},
+	},
+	[0xd8] = { /* U+00D8 LATIN CAPITAL LETTER O WITH STROKE */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			S__SS___,
+			S_S_S___,
+			S_S_S___,
+			SS__S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xd9] = { /* U+00D9 LATIN CAPITAL LETTER U WITH GRAVE */
+		.advance = 6,
+		.data = {
+			_S______,
+			S___S___,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xda] = { /* U+00DA LATIN CAPITAL LETTER U WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			S___S___,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xdb] = { /* U+00DB LATIN CAPITAL LETTER U WITH CIRCUMFLEX */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			S___S___,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xdc] = { /* U+00DC LATIN CAPITAL LETTER U WITH DIAERESIS */
+		.advance = 6,
+		.data = {
+			_S_S____,
+			S___S___,
+			S___S___,
+			S___S___,
+			S___S___,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xdd] = { /* U+00DD LATIN CAPITAL LETTER Y WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			S___S___,
+			S___S___,
+			_S_S____,
+			__S_____,
+			__S_____,
+			________,
+			________,
+		},
+	},
+	[0xde] = { /* U+00DE LATIN CAPITAL LETTER THORN */
+		.advance = 6,
+		.data = {
+			S_______,
+			SSSS____,
+			S___S___,
+			SSSS____,
+			S_______,
+			S_______,
+			________,
+			________,
+		},
+	},
+	[0xdf] = { /* U+00DF LATIN SMALL LETTER SHARP S */
+		.advance = 5,
+		.data = {
+			_SS_____,
+			S__S____,
+			S_S_____,
+			S__S____,
+			S__S____,
+			S_S_____,
+			________,
+			________,
+		},
+	},
+	[0xe0] = { /* U+00E0 LATIN SMALL LETTER A WITH GRAVE */
+		.advance = 5,
+		.data = {
+			S_______,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe1] = { /* U+00E1 LATIN SMALL LETTER A WITH ACUTE */
+		.advance = 5,
+		.data = {
+			__S_____,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe2] = { /* U+00E2 LATIN SMALL LETTER A WITH CIRCUMFLEX */
+		.advance = 5,
+		.data = {
+			SSS_____,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe3] = { /* U+00E3 LATIN SMALL LETTER A WITH TILDE */
+		.advance = 5,
+		.data = {
+			SS_S____,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe4] = { /* U+00E4 LATIN SMALL LETTER A WITH DIAERESIS */
+		.advance = 5,
+		.data = {
+			S_S_____,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe5] = { /* U+00E5 LATIN SMALL LETTER A WITH RING ABOVE */
+		.advance = 5,
+		.data = {
+			_S______,
+			SSS_____,
+			___S____,
+			_SSS____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xe6] = { /* U+00E6 LATIN SMALL LETTER AE */
+		.advance = 8,
+		.data = {
+			________,
+			SSS_SS__,
+			___S__S_,
+			_SSSSSS_,
+			S__S____,
+			_SSSSSS_,
+			________,
+			________,
+		},
+	},
+	[0xe7] = { /* U+00E7 LATIN SMALL LETTER C WITH CEDILLA */
+		.advance = 6,
+		.data = {
+			________,
+			_SSS____,
+			S___S___,
+			S_______,
+			S___S___,
+			_SSS____,
+			__S_____,
+			_S______,
+		},
+	},
+	[0xe8] = { /* U+00E8 LATIN SMALL LETTER E WITH GRAVE */
+		.advance = 6,
+		.data = {
+			_S______,
+			_SSS____,
+			S___S___,
+			SSSS____,
+			S_______,
+			_SSSS___,
+			________,
+			________,
+		},
+	},
+	[0xe9] = { /* U+00E9 LATIN SMALL LETTER E WITH ACUTE */
+		.advance = 6,
+		.data = {
+			___S____,
+			_SSS____,
+			S___S___,
+			SSSS____,
+			S_______,
+			_SSSS___,
+			________,
+			________,
+		},
+	},
+	[0xea] = { /* U+00EA LATIN SMALL LETTER E WITH CIRCUMFLEX */
+		.advance = 6,
+		.data = {
+			_SSS____,
+			_SSS____,
+			S___S___,
+			SSSS____,
+			S_______,
+			_SSSS___,
+			________,
+			________,
+		},
+	},
+	[0xeb] = { /* U+00EB LATIN SMALL LETTER E WITH DIAERESIS */
+		.advance = 6,
+		.data = {
+			_S_S____,
+			_SSS____,
+			S___S___,
+			SSSS____,
+			S_______,
+			_SSSS___,
+			________,
+			________,
+		},
+	},
+	[0xec] = { /* U+00EC LATIN SMALL LETTER I WITH GRAVE */
+		.advance = 4,
+		.data = {
+			________,
+			________,
+			_S______,
+			_S______,
+			_S______,
+			_S______,
+			________,
+			________,
+		},
+	},
+	[0xed] = { /* U+00ED LATIN SMALL LETTER I WITH ACUTE */
+		.advance = 4,
+		.data = {
+			_S______,
+			________,
+			_S______,
+			_S______,
+			_S______,
+			_S______,
+			________,
+			________,
+		},
+	},
+	[0xee] = { /* U+00EE LATIN SMALL LETTER I WITH CIRCUMFLEX */
+		.advance = 4,
+		.data = {
+			SS______,
+			________,
+			_S______,
+			_S______,
+			_S______,
+			_S______,
+			________,
+			________,
+		},
+	},
+	[0xef] = { /* U+00EF LATIN SMALL LETTER I WITH DIAERESIS */
+		.advance = 4,
+		.data = {
+			_S______,
+			________,
+			_S______,
+			_S______,
+			_S______,
+			_S______,
+			________,
+			________,
+		},
+	},
+	[0xf0] = { /* U+00F0 LATIN SMALL LETTER ETH */
+		.advance = 5,
+		.data = {
+			_S_S____,
+			__S_____,
+			_SSS____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf1] = { /* U+00F1 LATIN SMALL LETTER N WITH TILDE */
+		.advance = 5,
+		.data = {
+			SS_S____,
+			SSS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			________,
+			________,
+		},
+	},
+	[0xf2] = { /* U+00F2 LATIN SMALL LETTER O WITH GRAVE */
+		.advance = 5,
+		.data = {
+			S_______,
+			_SS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf3] = { /* U+00F3 LATIN SMALL LETTER O WITH ACUTE */
+		.advance = 5,
+		.data = {
+			__S_____,
+			_SS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf4] = { /* U+00F4 LATIN SMALL LETTER O WITH CIRCUMFLEX */
+		.advance = 5,
+		.data = {
+			SSS_____,
+			_SS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf5] = { /* U+00F5 LATIN SMALL LETTER O WITH TILDE */
+		.advance = 5,
+		.data = {
+			SS_S____,
+			_SS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf6] = { /* U+00F6 LATIN SMALL LETTER O WITH DIAERESIS */
+		.advance = 5,
+		.data = {
+			S_S_____,
+			_SS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SS_____,
+			________,
+			________,
+		},
+	},
+	[0xf7] = { /* U+00F7 DIVISION SIGN */
+		.advance = 4,
+		.data = {
+			________,
+			_S______,
+			________,
+			SSS_____,
+			________,
+			_S______,
+			________,
+			________,
+		},
+	},
+	[0xf8] = { /* U+00F8 LATIN SMALL LETTER O WITH STROKE */
+		.advance = 5,
+		.data = {
+			________,
+			_SSS____,
+			S__S____,
+			S_SS____,
+			SS_S____,
+			SSS_____,
+			________,
+			________,
+		},
+	},
+	[0xf9] = { /* U+00F9 LATIN SMALL LETTER U WITH GRAVE */
+		.advance = 5,
+		.data = {
+			S_______,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xfa] = { /* U+00FA LATIN SMALL LETTER U WITH ACUTE */
+		.advance = 5,
+		.data = {
+			__S_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xfb] = { /* U+00FB LATIN SMALL LETTER U WITH CIRCUMFLEX */
+		.advance = 5,
+		.data = {
+			SSS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xfc] = { /* U+00FC LATIN SMALL LETTER U WITH DIAERESIS */
+		.advance = 5,
+		.data = {
+			S_S_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			________,
+			________,
+		},
+	},
+	[0xfd] = { /* U+00FD LATIN SMALL LETTER Y WITH ACUTE */
+		.advance = 5,
+		.data = {
+			__S_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			___S____,
+			SSS_____,
+		},
+	},
+	[0xfe] = { /* U+00FE LATIN SMALL LETTER THORN */
+		.advance = 5,
+		.data = {
+			S_______,
+			SSS_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			SSS_____,
+			S_______,
+			S_______,
+		},
+	},
+	[0xff] = { /* U+00FF LATIN SMALL LETTER Y WITH DIAERESIS */
+		.advance = 5,
+		.data = {
+			S_S_____,
+			S__S____,
+			S__S____,
+			S__S____,
+			S__S____,
+			_SSS____,
+			___S____,
+			SSS_____,
+		},
+	},
 };
@@ -17,23 +17,201 @@
 #define CGIFH_GLYPH_WIDTH 8
 
 /**
- * Size of glyph array.
+ * Size of the built-in font's source glyph array.
  *
- * Only ASCII characters are supported (7-bit).
+ * The built-in font covers Latin-1 (8-bit).
  */
-#define CGIFH_GLYPH_COUNT (1U << 7)
+#define CGIFH_GLYPH_COUNT (1U << 8)
+
+/**
+ * Number of ASCII characters.
+ *
+ * Every font's first glyphs are the ASCII characters, indexed directly by
+ * code point. Other code points are looked up in the font's glyph map.
+ */
+#define CGIFH_FONT_ASCII (1U << 7)
+
+/** Largest code point a font can have a glyph for. */
+#define CGIFH_FONT_MAX_CP 0x10ffff
+
+/** Log2 of the number of code points in each glyph map block. */
+#define CGIFH_FONT_BLOCK_BITS 6
+
+/** Number of code points in each glyph map block. */
+#define CGIFH_FONT_BLOCK_SIZE (1U << CGIFH_FONT_BLOCK_BITS)
+
+/**
+ * Source bitmap for a glyph of the built-in font.
+ */
+typedef struct cgifh_glyph_bitmap {
+	int advance; /**< Horizontal advance in pixels. */
+	uint8_t data[CGIFH_GLYPH_HEIGHT]; /**< Rows, leftmost pixel in top bit. */
+} cgifh_glyph_bitmap_t;
+
+/**
+ * Horizontal run of set pixels in a glyph.
+ */
+typedef struct cgifh_glyph_span {
+	uint8_t row; /**< Pixel row. */
+	uint8_t x0;  /**< First pixel column. */
+	uint8_t x1;  /**< Column after the last pixel. */
+} cgifh_glyph_span_t;
+
+/**
+ * Bounding box of a glyph's set pixels, as half open ranges.
+ */
+typedef struct cgifh_glyph_box {
+	uint8_t x0; /**< Left column. */
+	uint8_t y0; /**< Top row. */
+	uint8_t x1; /**< Column after the right edge. */
+	uint8_t y1; /**< Row after the bottom edge. */
+} cgifh_glyph_box_t;
 
 /**
  * Bitmap font glyph structure.
+ *
+ * Glyphs are drawn from their spans, which are in row order. Their columns
+ * are the spans of the transposed glyph, in column order, with the row
+ * member giving the column and x0 and x1 giving the rows. Glyphs rotated
+ * by 90 or 270 degrees are drawn from their columns, so they are drawn
+ * with horizontal runs too.
  */
 typedef struct cgifh_glyph {
-	int advance;
-	uint8_t data[CGIFH_GLYPH_HEIGHT];
+	int advance;                       /**< Horizontal advance in pixels. */
+	const cgifh_glyph_span_t *spans;   /**< Spans of set pixels. */
+	unsigned span_count;               /**< Number of spans. */
+	const cgifh_glyph_span_t *columns; /**< Vertical spans of set pixels. */
+	unsigned column_count;             /**< Number of columns. */
+	cgifh_glyph_box_t box;             /**< Bounding box of the spans. */
 } cgifh_glyph_t;
 
 /**
- * Bitmap font data.
+ * Bitmap font.
+ *
+ * Glyphs for code points past ASCII are found with a two level map. The
+ * first level gives a block of the second level for each run of
+ * CGIFH_FONT_BLOCK_SIZE code points, and the block gives the glyph index
+ * for each code point. Block 0 is empty, and is shared by every run of
+ * code points without glyphs. Glyph index 0 is never an extended glyph,
+ * so it means there is no glyph.
+ */
+struct cgifh_font {
+	int width;    /**< Glyph bitmap width in pixels. */
+	int height;   /**< Glyph height in pixels. */
+	int overhang; /**< Most pixels any glyph draws past its advance. */
+	unsigned glyph_count;        /**< Number of glyphs. */
+	const cgifh_glyph_t *glyphs; /**< Glyphs, ASCII first. */
+	uint32_t block_count;        /**< Number of first level map entries. */
+	const uint16_t *blocks;      /**< First level of the glyph map. */
+	const uint16_t (*map)[CGIFH_FONT_BLOCK_SIZE]; /**< Second level. */
+};
+
+/**
+ * Built-in font source glyphs, indexed by code point.
+ *
+ * These are authored in font.c and compiled into cgifh_font_builtin by
+ * tools/fontc at build time; the library itself doesn't use them.
+ */
+extern const cgifh_glyph_bitmap_t font_h8[CGIFH_GLYPH_COUNT];
+
+/**
+ * Built-in font, generated from font_h8.
  */
-extern const cgifh_glyph_t font_h8[CGIFH_GLYPH_COUNT];
+extern const cgifh_font_t cgifh_font_builtin;
+
+/**
+ * Get the font to use, given a font that may be NULL.
+ *
+ * \param[in] font Font, or NULL for the built-in font.
+ * \return The font to use.
+ */
+static inline const cgifh_font_t *cgifh_font_get(const cgifh_font_t *font)
+{
+	return (font != NULL) ? font : &cgifh_font_builtin;
+}
+
+/**
+ * Get a font's glyph for a code point.
+ *
+ * \param[in] font Font to get glyph from.
+ * \param[in] cp   Unicode code point to get glyph for.
+ * \return Pointer to glyph structure or NULL if code point is not supported.
+ */
+static inline const cgifh_glyph_t *cgifh_font_glyph(
+		const cgifh_font_t *font,
+		uint32_t cp)
+{
+	uint32_t block = cp >> CGIFH_FONT_BLOCK_BITS;
+	uint16_t index;
+
+	if (cp < CGIFH_FONT_ASCII) {
+		return &font->glyphs[cp];
+
+	} else if (block >= font->block_count) {
+		return NULL;
+	}
+
+	index = font->map[font->blocks[block]][cp % CGIFH_FONT_BLOCK_SIZE];
+	return (index != 0) ? &font->glyphs[index] : NULL;
+}
+
+/**
+ * Get the built-in font's glyph for a Latin-1 character.
+ *
+ * \param[in] character  Character to get glyph for.
+ * \return Pointer to glyph structure or NULL if character is not supported.
+ */
+static inline const cgifh_glyph_t *cgifh_get_glyph(char character)
+{
+	return cgifh_font_glyph(&cgifh_font_builtin, (unsigned char) character);
+}
+
+/**
+ * Decode the next code point of UTF-8 text.
+ *
+ * Bytes that don't start a valid UTF-8 sequence are taken as Latin-1, so
+ * Latin-1 text also renders as expected.
+ *
+ * \param[in,out] text The text, updated to point past the code point.
+ * \return The code point.
+ */
+static inline uint32_t cgifh_utf8_next(const char **text)
+{
+	const unsigned char *p = (const unsigned char *) *text;
+	uint32_t cp = p[0];
+	uint32_t min;
+	int len;
+
+	if (cp < 0x80) {
+		*text += 1;
+		return cp;
+	} else if (cp >= 0xc2 && cp < 0xe0) {
+		cp &= 0x1f; len = 2; min = 0x80;
+	} else if (cp >= 0xe0 && cp < 0xf0) {
+		cp &= 0x0f; len = 3; min = 0x800;
+	} else if (cp >= 0xf0 && cp < 0xf5) {
+		cp &= 0x07; len = 4; min = 0x10000;
+	} else {
+		*text += 1;
+		return cp;
+	}
+
+	for (int i = 1; i < len; i++) {
+		if ((p[i] & 0xc0) != 0x80) {
+			*text += 1;
+			return p[0];
+		}
+		cp = cp << 6 | (p[i] & 0x3fu);
+	}
+
+	if (cp < min || cp > CGIFH_FONT_MAX_CP ||
+	    (cp >= 0xd800 && cp < 0xe000)) {
+		*text += 1;
+		return p[0];
+	}
+
+	*text += len;
+	return cp;
+}
 
 #endif /* CGIFH_FONT_H */
@@ -0,0 +1,976 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Font creation and loading.
+ *
+ * Fonts are built up as a list of glyphs, each with a code point, an
+ * advance and a bitmap of the font's full cell size. Once every bitmap is
+ * filled in, the glyphs are compiled into the spans, columns and bounding
+ * boxes that glyphs are drawn from, in the same form tools/fontc generates for
+ * the built-in font.
+ *
+ * The finished font is held in a single allocation: the font, then its
+ * glyphs, then the two levels of its glyph map, then the spans and then
+ * the columns. ASCII glyphs come first, indexed by code point, and the rest
+ * follow in the order they were added. Where a code point is given more than one glyph,
+ * the first one is used.
+ *
+ * Loaded fonts are rasterised into this form, so BDF glyph bounding boxes
+ * are placed in the font bounding box, and PSF glyphs are copied as is.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "font.h"
+
+/** Largest supported glyph width or height in pixels. */
+#define CGIFH_FONT_MAX_SIZE 255
+
+/** Largest BDF advance, bounding box size or offset accepted, in pixels. */
+#define CGIFH_FONT_BDF_MAX_EXTENT (4 * CGIFH_FONT_MAX_SIZE)
+
+/** Most glyphs a font can have, since glyph map entries are 16-bit. */
+#define CGIFH_FONT_MAX_GLYPHS (UINT16_MAX + 1u)
+
+/**
+ * A glyph being built.
+ */
+typedef struct cgifh_font_entry {
+	uint32_t cp;    /**< Code point. */
+	int advance;    /**< Horizontal advance in pixels. */
+	uint32_t index; /**< Glyph index, or UINT32_MAX if unused. */
+} cgifh_font_entry_t;
+
+/**
+ * Font builder, which collects glyphs before the font is created.
+ */
+typedef struct cgifh_font_builder {
+	int width;                   /**< Glyph bitmap width in pixels. */
+	int height;                  /**< Glyph height in pixels. */
+	int stride;                  /**< Bytes per bitmap row. */
+	size_t glyph_size;           /**< Bytes per glyph bitmap. */
+	size_t count;                /**< Number of glyphs added. */
+	size_t alloc;                /**< Number of glyphs allocated. */
+	cgifh_font_entry_t *entries; /**< Glyphs added. */
+	uint8_t *bitmaps;            /**< Bitmap of each glyph added. */
+} cgifh_font_builder_t;
+
+/**
+ * Initialise a font builder.
+ *
+ * \param[out] b      The builder to initialise.
+ * \param[in]  width  Glyph bitmap width in pixels.
+ * \param[in]  height Glyph height in pixels.
+ * \return true on success, or false if the size is not supported.
+ */
+static bool cgifh_font_builder_init(
+		cgifh_font_builder_t *b,
+		int width,
+		int height)
+{
+	*b = (cgifh_font_builder_t) { 0 };
+
+	if (width < 1 || width > CGIFH_FONT_MAX_SIZE ||
+	    height < 1 || height > CGIFH_FONT_MAX_SIZE) {
+		return false;
+	}
+
+	b->width = width;
+	b->height = height;
+	b->stride = (width + 7) / 8;
+	b->glyph_size = (size_t) (b->stride * height);
+	return true;
+}
+
+/**
+ * Free a font builder's resources.
+ *
+ * \param[in] b The builder.
+ */
+static void cgifh_font_builder_fini(cgifh_font_builder_t *b)
+{
+	free(b->entries);
+	free(b->bitmaps);
+}
+
+/**
+ * Get the bitmap of a glyph being built.
+ *
+ * The pointer is only valid until the next glyph is added.
+ *
+ * \param[in] b     The builder.
+ * \param[in] entry Index of the glyph.
+ * \return The glyph's bitmap.
+ */
+static inline uint8_t *cgifh_font_builder_bitmap(
+		const cgifh_font_builder_t *b,
+		size_t entry)
+{
+	return b->bitmaps + entry * b->glyph_size;
+}
+
+/**
+ * Add a blank glyph to a font builder.
+ *
+ * \param[in] b       The builder.
+ * \param[in] cp      Code point of the glyph.
+ * \param[in] advance Horizontal advance in pixels.
+ * \return The glyph's bitmap, or NULL on failure.
+ */
+static uint8_t *cgifh_font_builder_add(
+		cgifh_font_builder_t *b,
+		uint32_t cp,
+		int advance)
+{
+	if (b->count == b->alloc) {
+		size_t alloc = (b->alloc == 0) ? 256 : b->alloc * 2;
+		cgifh_font_entry_t *entries;
+		uint8_t *bitmaps;
+
+		entries = realloc(b->entries, alloc * sizeof(*entries));
+		if (entries == NULL) {
+			return NULL;
+		}
+		b->entries = entries;
+
+		bitmaps = realloc(b->bitmaps, alloc * b->glyph_size);
+		if (bitmaps == NULL) {
+			return NULL;
+		}
+		b->bitmaps = bitmaps;
+		b->alloc = alloc;
+	}
+
+	b->entries[b->count] = (cgifh_font_entry_t) {
+		.cp = cp,
+		.advance = (advance > 0) ? advance : 0,
+	};
+	memset(cgifh_font_builder_bitmap(b, b->count), 0, b->glyph_size);
+
+	return cgifh_font_builder_bitmap(b, b->count++);
+}
+
+/**
+ * Test whether a glyph bitmap pixel is set.
+ *
+ * \param[in] b      The builder.
+ * \param[in] bitmap The glyph's bitmap.
+ * \param[in] col    Pixel column.
+ * \param[in] row    Pixel row.
+ * \return true if the pixel is set.
+ */
+static inline bool cgifh_font_bit(
+		const cgifh_font_builder_t *b,
+		const uint8_t *bitmap,
+		int col,
+		int row)
+{
+	uint8_t byte = bitmap[row * b->stride + col / 8];
+
+	return (byte & (0x80u >> (col % 8))) != 0;
+}
+
+/**
+ * Find the spans of set pixels in a glyph's bitmap.
+ *
+ * \param[in]  b      The builder.
+ * \param[in]  bitmap The glyph's bitmap.
+ * \param[out] spans  Returns the spans, or NULL to only count them.
+ * \param[out] box    Returns the bounding box of the spans.
+ * \return The number of spans.
+ */
+static unsigned cgifh_font_spans(
+		const cgifh_font_builder_t *b,
+		const uint8_t *bitmap,
+		cgifh_glyph_span_t *spans,
+		cgifh_glyph_box_t *box)
+{
+	unsigned count = 0;
+
+	*box = (cgifh_glyph_box_t) {
+		.x0 = UINT8_MAX,
+		.y0 = UINT8_MAX,
+	};
+
+	for (int row = 0; row < b->height; row++) {
+		int col = 0;
+
+		while (col < b->width) {
+			int x0;
+
+			if (!cgifh_font_bit(b, bitmap, col, row)) {
+				col++;
+				continue;
+			}
+			x0 = col;
+			while (col < b->width &&
+					cgifh_font_bit(b, bitmap, col, row)) {
+				col++;
+			}
+
+			if (spans != NULL) {
+				spans[count] = (cgifh_glyph_span_t) {
+					.row = (uint8_t) row,
+					.x0 = (uint8_t) x0,
+					.x1 = (uint8_t) col,
+				};
+			}
+			count++;
+
+			box->x0 = (x0 < box->x0) ? (uint8_t) x0 : box->x0;
+			box->x1 = (col > box->x1) ? (uint8_t) col : box->x1;
+			box->y0 = (row < box->y0) ? (uint8_t) row : box->y0;
+			box->y1 = (uint8_t) (row + 1);
+		}
+	}
+
+	if (count == 0) {
+		*box = (cgifh_glyph_box_t) { 0 };
+	}
+
+	return count;
+}
+
+/**
+ * Find the columns of set pixels in a glyph's bitmap.
+ *
+ * \param[in]  b       The builder.
+ * \param[in]  bitmap  The glyph's bitmap.
+ * \param[out] columns Returns the columns, or NULL to only count them.
+ * \return The number of columns.
+ */
+static unsigned cgifh_font_columns(
+		const cgifh_font_builder_t *b,
+		const uint8_t *bitmap,
+		cgifh_glyph_span_t *columns)
+{
+	unsigned count = 0;
+
+	for (int col = 0; col < b->width; col++) {
+		int row = 0;
+
+		while (row < b->height) {
+			int y0;
+
+			if (!cgifh_font_bit(b, bitmap, col, row)) {
+				row++;
+				continue;
+			}
+			y0 = row;
+			while (row < b->height &&
+					cgifh_font_bit(b, bitmap, col, row)) {
+				row++;
+			}
+
+			if (columns != NULL) {
+				columns[count] = (cgifh_glyph_span_t) {
+					.row = (uint8_t) col,
+					.x0 = (uint8_t) y0,
+					.x1 = (uint8_t) row,
+				};
+			}
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Create a font from the glyphs in a font builder.
+ *
+ * Assigns each code point's first glyph an index, and builds the glyph
+ * map, spans, columns and bounding boxes. The builder is finalised either way.
+ *
+ * \param[in] b The builder.
+ * \return The new font, or NULL on failure.
+ */
+static cgifh_font_t *cgifh_font_build(cgifh_font_builder_t *b)
+{
+	bool ascii[CGIFH_FONT_ASCII] = { false };
+	uint16_t (*map)[CGIFH_FONT_BLOCK_SIZE] = NULL;
+	uint32_t block_count = 0;
+	uint32_t map_count = 1;
+	uint32_t glyph_count = CGIFH_FONT_ASCII;
+	uint16_t *blocks = NULL;
+	cgifh_font_t *font = NULL;
+	cgifh_glyph_span_t *columns;
+	cgifh_glyph_span_t *spans;
+	cgifh_glyph_t *glyphs;
+	size_t column_count = 0;
+	size_t span_count = 0;
+
+	for (size_t i = 0; i < b->count; i++) {
+		uint32_t cp = b->entries[i].cp;
+
+		if (cp >= CGIFH_FONT_ASCII &&
+		    (cp >> CGIFH_FONT_BLOCK_BITS) >= block_count) {
+			block_count = (cp >> CGIFH_FONT_BLOCK_BITS) + 1;
+		}
+	}
+
+	/* Number the blocks that have glyphs, leaving block 0 empty. */
+	blocks = calloc(block_count + 1, sizeof(*blocks));
+	if (blocks == NULL) {
+		goto cleanup;
+	}
+	for (size_t i = 0; i < b->count; i++) {
+		uint32_t cp = b->entries[i].cp;
+
+		if (cp >= CGIFH_FONT_ASCII) {
+			blocks[cp >> CGIFH_FONT_BLOCK_BITS] = 1;
+		}
+	}
+	for (uint32_t i = 0; i < block_count; i++) {
+		if (blocks[i] != 0) {
+			blocks[i] = (uint16_t) map_count++;
+		}
+	}
+
+	map = calloc(map_count, sizeof(*map));
+	if (map == NULL) {
+		goto cleanup;
+	}
+
+	for (size_t i = 0; i < b->count; i++) {
+		cgifh_font_entry_t *entry = &b->entries[i];
+		const uint8_t *bitmap = cgifh_font_builder_bitmap(b, i);
+		uint16_t *slot;
+		cgifh_glyph_box_t box;
+
+		entry->index = UINT32_MAX;
+		if (entry->cp < CGIFH_FONT_ASCII) {
+			if (ascii[entry->cp]) {
+				continue;
+			}
+			ascii[entry->cp] = true;
+			entry->index = entry->cp;
+		} else {
+			slot = &map[blocks[entry->cp >> CGIFH_FONT_BLOCK_BITS]]
+					[entry->cp % CGIFH_FONT_BLOCK_SIZE];
+			if (*slot != 0 || glyph_count == CGIFH_FONT_MAX_GLYPHS) {
+				continue;
+			}
+			*slot = (uint16_t) glyph_count;
+			entry->index = glyph_count++;
+		}
+		span_count += cgifh_font_spans(b, bitmap, NULL, &box);
+		column_count += cgifh_font_columns(b, bitmap, NULL);
+	}
+
+	font = calloc(1, sizeof(*font) +
+			glyph_count * sizeof(*glyphs) +
+			map_count * sizeof(*map) +
+			block_count * sizeof(*blocks) +
+			(span_count + column_count) * sizeof(*spans));
+	if (font == NULL) {
+		goto cleanup;
+	}
+	glyphs = (cgifh_glyph_t *) (void *) (font + 1);
+	font->map = (void *) (glyphs + glyph_count);
+	font->blocks = (void *) (font->map + map_count);
+	spans = (void *) (font->blocks + block_count);
+	columns = spans + span_count;
+
+	memcpy((void *) font->map, map, map_count * sizeof(*map));
+	memcpy((void *) font->blocks, blocks, block_count * sizeof(*blocks));
+
+	font->width = b->width;
+	font->height = b->height;
+	font->glyph_count = glyph_count;
+	font->glyphs = glyphs;
+	font->block_count = block_count;
+
+	for (uint32_t i = 0; i < glyph_count; i++) {
+		glyphs[i].spans = spans;
+		glyphs[i].columns = columns;
+	}
+
+	for (size_t i = 0; i < b->count; i++) {
+		const cgifh_font_entry_t *entry = &b->entries[i];
+		cgifh_glyph_t *glyph;
+		int overhang;
+
+		if (entry->index == UINT32_MAX) {
+			continue;
+		}
+		glyph = &glyphs[entry->index];
+
+		glyph->advance = entry->advance;
+		glyph->spans = spans;
+		glyph->span_count = cgifh_font_spans(b,
+				cgifh_font_builder_bitmap(b, i),
+				spans, &glyph->box);
+		spans += glyph->span_count;
+		glyph->columns = columns;
+		glyph->column_count = cgifh_font_columns(b,
+				cgifh_font_builder_bitmap(b, i), columns);
+		columns += glyph->column_count;
+
+		overhang = glyph->box.x1 - glyph->advance;
+		if (overhang > font->overhang) {
+			font->overhang = overhang;
+		}
+	}
+
+cleanup:
+	cgifh_font_builder_fini(b);
+	free(blocks);
+	free(map);
+	return font;
+}
+
+/**
+ * Check whether a glyph bitmap is blank.
+ *
+ * \param[in] bitmap The bitmap.
+ * \param[in] size   Size of the bitmap in bytes.
+ * \return true if no pixels are set.
+ */
+static bool cgifh_font_blank(const uint8_t *bitmap, size_t size)
+{
+	for (size_t i = 0; i < size; i++) {
+		if (bitmap[i] != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_font_t *cgifh_font_create(
+		int width,
+		int height,
+		unsigned first,
+		unsigned count,
+		const uint8_t *advances,
+		const uint8_t *bitmap)
+{
+	cgifh_font_builder_t b;
+
+	if (!cgifh_font_builder_init(&b, width, height)) {
+		return NULL;
+	}
+
+	for (unsigned i = 0; i < count; i++) {
+		const uint8_t *data = bitmap + i * b.glyph_size;
+		uint32_t cp = (uint32_t) first + i;
+		uint8_t *glyph;
+
+		if (cp < first || cp > CGIFH_FONT_MAX_CP) {
+			break;
+		} else if (advances[i] == 0 &&
+		           cgifh_font_blank(data, b.glyph_size)) {
+			continue;
+		}
+
+		glyph = cgifh_font_builder_add(&b, cp, advances[i]);
+		if (glyph == NULL) {
+			cgifh_font_builder_fini(&b);
+			return NULL;
+		}
+		memcpy(glyph, data, b.glyph_size);
+	}
+
+	return cgifh_font_build(&b);
+}
+
+/**
+ * Reader for line based font files.
+ */
+typedef struct cgifh_font_reader {
+	const char *pos; /**< Start of the next line. */
+	const char *end; /**< End of the data. */
+} cgifh_font_reader_t;
+
+/**
+ * Read the next line of a font file.
+ *
+ * Lines longer than the buffer are truncated.
+ *
+ * \param[in]  reader The reader.
+ * \param[out] line   Buffer to read the line into.
+ * \param[in]  size   Size of the buffer in bytes.
+ * \return false at the end of the data, true otherwise.
+ */
+static bool cgifh_font_read_line(
+		cgifh_font_reader_t *reader,
+		char *line,
+		size_t size)
+{
+	size_t len = 0;
+
+	if (reader->pos >= reader->end) {
+		return false;
+	}
+
+	while (reader->pos < reader->end && *reader->pos != '\n') {
+		if (len + 1 < size && *reader->pos != '\r') {
+			line[len++] = *reader->pos;
+		}
+		reader->pos++;
+	}
+	if (reader->pos < reader->end) {
+		reader->pos++;
+	}
+	line[len] = '\0';
+
+	return true;
+}
+
+/**
+ * Check whether a line starts with a keyword.
+ *
+ * \param[in] line    The line.
+ * \param[in] keyword The keyword.
+ * \return true if the line starts with the keyword as a whole word.
+ */
+static bool cgifh_font_keyword(const char *line, const char *keyword)
+{
+	size_t len = strlen(keyword);
+
+	return strncmp(line, keyword, len) == 0 &&
+			(line[len] == '\0' || line[len] == ' ');
+}
+
+/**
+ * Get the value of a hex digit.
+ *
+ * \param[in] c The hex digit.
+ * \return The digit's value, or -1 if it is not a hex digit.
+ */
+static inline int cgifh_font_hex(char c)
+{
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	} else if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+/**
+ * Draw a row of BDF glyph bitmap into a glyph.
+ *
+ * \param[in] b      The font builder.
+ * \param[in] bitmap The glyph bitmap to draw into.
+ * \param[in] hex    The row of bitmap, in hex.
+ * \param[in] w      The width of the row in pixels.
+ * \param[in] x      Column of the glyph to draw the row at.
+ * \param[in] y      Row of the glyph to draw the row at.
+ */
+static void cgifh_font_bdf_row(
+		const cgifh_font_builder_t *b,
+		uint8_t *bitmap,
+		const char *hex,
+		int w,
+		int x,
+		int y)
+{
+	uint8_t *row = bitmap + y * b->stride;
+
+	for (int col = 0; col < w; col += 4) {
+		int nibble = cgifh_font_hex(hex[col / 4]);
+
+		if (nibble < 0) {
+			break;
+		}
+
+		for (int bit = 0; bit < 4 && col + bit < w; bit++) {
+			int xx = x + col + bit;
+
+			if ((nibble & (0x8 >> bit)) != 0 &&
+			    xx >= 0 && xx < b->width) {
+				row[xx / 8] |= (uint8_t) (0x80u >> (xx % 8));
+			}
+		}
+	}
+}
+
+/**
+ * Check a BDF advance, bounding box size or offset is within range.
+ *
+ * \param[in] value The value to check.
+ * \return true if the value is within range, false otherwise.
+ */
+static inline bool cgifh_font_bdf_extent(int value)
+{
+	return value >= -CGIFH_FONT_BDF_MAX_EXTENT &&
+	       value <= CGIFH_FONT_BDF_MAX_EXTENT;
+}
+
+/**
+ * Load a font from BDF data.
+ *
+ * \param[in] data BDF file contents.
+ * \param[in] size Size of the BDF file in bytes.
+ * \return The new font, or NULL on failure.
+ */
+static cgifh_font_t *cgifh_font_load_bdf(const char *data, size_t size)
+{
+	cgifh_font_reader_t reader = { .pos = data, .end = data + size };
+	cgifh_font_builder_t b = { 0 };
+	int fbb_w = 0, fbb_h = 0, fbb_x = 0, fbb_y = 0;
+	bool started = false;
+	char line[512];
+
+	while (cgifh_font_read_line(&reader, line, sizeof(line))) {
+		if (cgifh_font_keyword(line, "FONTBOUNDINGBOX")) {
+			if (started || sscanf(line,
+					"FONTBOUNDINGBOX %d %d %d %d",
+					&fbb_w, &fbb_h, &fbb_x, &fbb_y) != 4 ||
+			    !cgifh_font_bdf_extent(fbb_x) ||
+			    !cgifh_font_bdf_extent(fbb_y) ||
+			    !cgifh_font_builder_init(&b, fbb_w, fbb_h)) {
+				break;
+			}
+			started = true;
+
+		} else if (cgifh_font_keyword(line, "STARTCHAR")) {
+			long encoding = -1;
+			int advance = fbb_w;
+			int w = 0, h = 0, x = 0, y = 0;
+			size_t entry = SIZE_MAX;
+			int row = -1;
+
+			if (!started) {
+				break;
+			}
+
+			while (cgifh_font_read_line(&reader,
+					line, sizeof(line)) &&
+			       !cgifh_font_keyword(line, "ENDCHAR")) {
+				if (row >= 0) {
+					/* Rows are placed in the font
+					 * bounding box by baseline. */
+					int64_t yy = (int64_t) fbb_h + fbb_y -
+							((int64_t) y + h) + row;
+
+					if (row < h && yy >= 0 && yy < fbb_h &&
+					    entry != SIZE_MAX) {
+						cgifh_font_bdf_row(&b,
+							cgifh_font_builder_bitmap(
+								&b, entry),
+							line, w, x - fbb_x,
+							(int) yy);
+					}
+					row++;
+				} else if (cgifh_font_keyword(line,
+						"ENCODING")) {
+					sscanf(line, "ENCODING %ld", &encoding);
+				} else if (cgifh_font_keyword(line,
+						"DWIDTH")) {
+					sscanf(line, "DWIDTH %d", &advance);
+					if (!cgifh_font_bdf_extent(advance)) {
+						goto cleanup;
+					}
+				} else if (cgifh_font_keyword(line, "BBX")) {
+					sscanf(line, "BBX %d %d %d %d",
+							&w, &h, &x, &y);
+					if (w < 0 || h < 0 ||
+					    !cgifh_font_bdf_extent(w) ||
+					    !cgifh_font_bdf_extent(h) ||
+					    !cgifh_font_bdf_extent(x) ||
+					    !cgifh_font_bdf_extent(y)) {
+						goto cleanup;
+					}
+				} else if (cgifh_font_keyword(line,
+						"BITMAP")) {
+					row = 0;
+					if (encoding < 0 ||
+					    encoding > CGIFH_FONT_MAX_CP) {
+						continue;
+					} else if (cgifh_font_builder_add(&b,
+							(uint32_t) encoding,
+							advance) == NULL) {
+						goto cleanup;
+					}
+					entry = b.count - 1;
+				}
+			}
+
+			if (entry != SIZE_MAX) {
+				b.entries[entry].advance =
+						(advance > 0) ? advance : 0;
+			}
+
+		} else if (cgifh_font_keyword(line, "ENDFONT")) {
+			if (!started) {
+				break;
+			}
+			return cgifh_font_build(&b);
+		}
+	}
+
+	/* Malformed, or truncated before ENDFONT. */
+cleanup:
+	cgifh_font_builder_fini(&b);
+	return NULL;
+}
+
+/**
+ * Read a little endian 32-bit value.
+ *
+ * \param[in] data Data to read from.
+ * \return The value.
+ */
+static inline uint32_t cgifh_font_u32(const uint8_t *data)
+{
+	return (uint32_t) data[0] |
+	       (uint32_t) data[1] << 8 |
+	       (uint32_t) data[2] << 16 |
+	       (uint32_t) data[3] << 24;
+}
+
+/**
+ * Add a PSF glyph to a font builder, for a given code point.
+ *
+ * Glyphs for code points a font can't have are ignored.
+ *
+ * \param[in] b    The font builder.
+ * \param[in] cp   The code point.
+ * \param[in] data The PSF glyph bitmap.
+ * \return false on failure, true otherwise.
+ */
+static bool cgifh_font_psf_glyph(
+		cgifh_font_builder_t *b,
+		uint32_t cp,
+		const uint8_t *data)
+{
+	uint8_t *bitmap;
+
+	if (cp > CGIFH_FONT_MAX_CP) {
+		return true;
+	}
+
+	bitmap = cgifh_font_builder_add(b, cp, b->width);
+	if (bitmap == NULL) {
+		return false;
+	}
+
+	memcpy(bitmap, data, b->glyph_size);
+	return true;
+}
+
+/**
+ * Decode a UTF-8 code point from a PSF2 Unicode table.
+ *
+ * \param[in,out] pos Position in the table, updated past the code point.
+ * \param[in]     end End of the table.
+ * \return The code point, or UINT32_MAX if it is malformed.
+ */
+static uint32_t cgifh_font_psf2_utf8(const uint8_t **pos, const uint8_t *end)
+{
+	static const uint8_t lead_mask[] = { 0x7f, 0x1f, 0x0f, 0x07 };
+	const uint8_t *p = *pos;
+	uint32_t cp = *p++;
+	int extra = (cp >= 0xf0) ? 3 : (cp >= 0xe0) ? 2 : (cp >= 0xc0) ? 1 : 0;
+
+	if (cp >= 0x80 && cp < 0xc0) {
+		*pos = p;
+		return UINT32_MAX;
+	}
+
+	cp &= lead_mask[extra];
+	for (; extra > 0; extra--) {
+		if (p == end || (*p & 0xc0) != 0x80) {
+			*pos = p;
+			return UINT32_MAX;
+		}
+		cp = cp << 6 | (*p++ & 0x3fu);
+	}
+
+	*pos = p;
+	return cp;
+}
+
+/**
+ * Load a font from PSF data.
+ *
+ * \param[in] data PSF file contents.
+ * \param[in] size Size of the PSF file in bytes.
+ * \return The new font, or NULL on failure.
+ */
+static cgifh_font_t *cgifh_font_load_psf(const uint8_t *data, size_t size)
+{
+	uint32_t count, glyph_size, header, width, height;
+	const uint8_t *table;
+	const uint8_t *end = data + size;
+	cgifh_font_builder_t b;
+	bool psf2 = (data[0] == 0x72);
+	bool unicode;
+
+	if (psf2) {
+		if (size < 32) {
+			return NULL;
+		}
+		header = cgifh_font_u32(data + 8);
+		unicode = (cgifh_font_u32(data + 12) & 0x1) != 0;
+		count = cgifh_font_u32(data + 16);
+		glyph_size = cgifh_font_u32(data + 20);
+		height = cgifh_font_u32(data + 24);
+		width = cgifh_font_u32(data + 28);
+	} else {
+		header = 4;
+		unicode = (data[2] & 0x06) != 0;
+		count = (data[2] & 0x01) ? 512 : 256;
+		glyph_size = data[3];
+		height = data[3];
+		width = 8;
+	}
+
+	if (width < 1 || width > CGIFH_FONT_MAX_SIZE ||
+	    height < 1 || height > CGIFH_FONT_MAX_SIZE ||
+	    glyph_size < (width + 7) / 8 * height ||
+	    header > size || count > (size - header) / glyph_size) {
+		return NULL;
+	}
+	table = data + header + (size_t) count * glyph_size;
+
+	if (!cgifh_font_builder_init(&b, (int) width, (int) height)) {
+		return NULL;
+	}
+
+	for (uint32_t g = 0; g < count; g++) {
+		const uint8_t *bitmap = data + header + (size_t) g * glyph_size;
+
+		if (!unicode) {
+			if (!cgifh_font_psf_glyph(&b, g, bitmap)) {
+				goto cleanup;
+			}
+			continue;
+		}
+
+		/* Each glyph's entry lists its code points, then optional
+		 * sequences we don't support, then a terminator. */
+		if (psf2) {
+			bool sequence = false;
+
+			while (table < end && *table != 0xff) {
+				if (*table == 0xfe) {
+					sequence = true;
+					table++;
+				} else {
+					uint32_t cp = cgifh_font_psf2_utf8(
+							&table, end);
+					if (!sequence &&
+					    !cgifh_font_psf_glyph(&b,
+							cp, bitmap)) {
+						goto cleanup;
+					}
+				}
+			}
+			table++;
+		} else {
+			bool sequence = false;
+
+			while (table + 1 < end &&
+			       (table[0] | table[1] << 8) != 0xffff) {
+				uint32_t cp = (uint32_t) (table[0] |
+						table[1] << 8);
+				if (cp == 0xfffe) {
+					sequence = true;
+				} else if (!sequence &&
+				           !cgifh_font_psf_glyph(&b,
+							cp, bitmap)) {
+					goto cleanup;
+				}
+				table += 2;
+			}
+			table += 2;
+		}
+		if (table >= end) {
+			break;
+		}
+	}
+
+	return cgifh_font_build(&b);
+
+cleanup:
+	cgifh_font_builder_fini(&b);
+	return NULL;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_font_t *cgifh_font_load_data(
+		const void *data,
+		size_t size)
+{
+	const uint8_t *bytes = data;
+
+	if (size >= 4 && bytes[0] == 0x72 && bytes[1] == 0xb5 &&
+	    bytes[2] == 0x4a && bytes[3] == 0x86) {
+		return cgifh_font_load_psf(bytes, size);
+
+	} else if (size >= 4 && bytes[0] == 0x36 && bytes[1] == 0x04) {
+		return cgifh_font_load_psf(bytes, size);
+	}
+
+	return cgifh_font_load_bdf(data, size);
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_font_t *cgifh_font_load(const char *path)
+{
+	cgifh_font_t *font = NULL;
+	uint8_t *data = NULL;
+	size_t size = 0;
+	size_t alloc = 0;
+	FILE *file;
+
+	file = fopen(path, "rb");
+	if (file == NULL) {
+		return NULL;
+	}
+
+	for (;;) {
+		size_t got;
+
+		if (size == alloc) {
+			uint8_t *temp;
+
+			alloc = (alloc == 0) ? 64 * 1024 : alloc * 2;
+			temp = realloc(data, alloc);
+			if (temp == NULL) {
+				goto cleanup;
+			}
+			data = temp;
+		}
+
+		got = fread(data + size, 1, alloc - size, file);
+		size += got;
+		if (got == 0) {
+			break;
+		}
+	}
+
+	if (!ferror(file)) {
+		font = cgifh_font_load_data(data, size);
+	}
+
+cleanup:
+	free(data);
+	fclose(file);
+	return font;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_font_destroy(cgifh_font_t *font)
+{
+	if (font == NULL) {
+		return;
+	}
+
+	free(font);
+}
@@ -0,0 +1,342 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Heat map rendering.
+ *
+ * Grid values are converted to fixed point palette positions a grid row at a
+ * time, then each image row is produced by looking up the positions for its
+ * pixels' grid columns. Image rows that come from the same grid row are
+ * copied when no dithering is needed.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "ctx.h"
+#include "dither.h"
+
+/** Number of fraction bits in fixed point palette positions. */
+#define CGIFH_HEATMAP_FRAC_BITS 8
+
+/** Fixed point palette position rounding offset. */
+#define CGIFH_HEATMAP_HALF (1U << (CGIFH_HEATMAP_FRAC_BITS - 1))
+
+/** Fixed point palette position fraction mask. */
+#define CGIFH_HEATMAP_FRAC_MASK ((1U << CGIFH_HEATMAP_FRAC_BITS) - 1)
+
+/**
+ * Heat map value to fixed point palette position conversion.
+ *
+ * position = (f(value) - offset) * factor, clamped to 0..limit, where f is
+ * the identity function for linear scales, or log for log scales.
+ */
+typedef struct cgifh_heatmap_conv {
+	double offset; /**< Scaled value of the map's minimum value. */
+	double factor; /**< Scaled value to palette position multiplier. */
+	double limit;  /**< Palette position of the map's last entry. */
+	bool log;      /**< Whether to take the log of values. */
+} cgifh_heatmap_conv_t;
+
+/**
+ * Set up the value conversion for a heat map mapping.
+ *
+ * \param[in]  map  The value to palette mapping.
+ * \param[out] conv Returns the value conversion on success.
+ * \return true on success, or false if the mapping is invalid.
+ */
+static bool cgifh_heatmap_conv_init(
+		const cgifh_heatmap_t *map,
+		cgifh_heatmap_conv_t *conv)
+{
+	double lo = map->min;
+	double hi = map->max;
+
+	if (map->count < 1 ||
+	    map->first + map->count > CGIFH_PALETTE_MAX ||
+	    !(hi > lo)) {
+		return false;
+	}
+
+	conv->log = (map->scale == CGIFH_HEATMAP_LOG);
+	if (conv->log) {
+		if (!(lo > 0)) {
+			return false;
+		}
+		lo = log(lo);
+		hi = log(hi);
+	}
+
+	conv->limit = (double) ((map->count - 1) << CGIFH_HEATMAP_FRAC_BITS);
+	conv->offset = lo;
+	conv->factor = conv->limit / (hi - lo);
+
+	return true;
+}
+
+/**
+ * Convert a run of floating point grid values to palette positions.
+ *
+ * \param[in]  conv      The value conversion.
+ * \param[in]  values    The grid values.
+ * \param[in]  count     The number of values.
+ * \param[out] positions Array to receive the fixed point palette positions.
+ */
+static void cgifh_heatmap_positions_float(
+		const cgifh_heatmap_conv_t *conv,
+		const float *restrict values,
+		int count,
+		uint16_t *restrict positions)
+{
+	float offset = (float) conv->offset;
+	float factor = (float) conv->factor;
+	float limit = (float) conv->limit;
+
+	/* The comparisons are ordered so that NaN clamps to zero. */
+	if (conv->log) {
+		for (int i = 0; i < count; i++) {
+			float p = (logf(values[i]) - offset) * factor;
+
+			p = (p > 0) ? p : 0;
+			p = (p < limit) ? p : limit;
+			positions[i] = (uint16_t) p;
+		}
+	} else {
+		for (int i = 0; i < count; i++) {
+			float p = (values[i] - offset) * factor;
+
+			p = (p > 0) ? p : 0;
+			p = (p < limit) ? p : limit;
+			positions[i] = (uint16_t) p;
+		}
+	}
+}
+
+/**
+ * Convert a run of integer grid values to palette positions.
+ *
+ * \param[in]  conv      The value conversion.
+ * \param[in]  values    The grid values.
+ * \param[in]  count     The number of values.
+ * \param[out] positions Array to receive the fixed point palette positions.
+ */
+static void cgifh_heatmap_positions_int(
+		const cgifh_heatmap_conv_t *conv,
+		const int32_t *restrict values,
+		int count,
+		uint16_t *restrict positions)
+{
+	double offset = conv->offset;
+	double factor = conv->factor;
+	double limit = conv->limit;
+
+	/* The comparisons are ordered so that NaN clamps to zero. */
+	if (conv->log) {
+		for (int i = 0; i < count; i++) {
+			double p = (log(values[i]) - offset) * factor;
+
+			p = (p > 0) ? p : 0;
+			p = (p < limit) ? p : limit;
+			positions[i] = (uint16_t) p;
+		}
+	} else {
+		for (int i = 0; i < count; i++) {
+			double p = (values[i] - offset) * factor;
+
+			p = (p > 0) ? p : 0;
+			p = (p < limit) ? p : limit;
+			positions[i] = (uint16_t) p;
+		}
+	}
+}
+
+/**
+ * Render a heat map row with nearest palette entry sampling.
+ *
+ * \param[out] dst       The image row span to render to.
+ * \param[in]  positions Palette positions for the grid row, by grid column.
+ * \param[in]  cols      Grid column for each pixel in the span.
+ * \param[in]  len       The length of the span in pixels.
+ * \param[in]  first     Palette index of the map's first palette entry.
+ */
+static void cgifh_heatmap_row_nearest(
+		uint8_t *restrict dst,
+		const uint16_t *restrict positions,
+		const int *restrict cols,
+		int len,
+		uint8_t first)
+{
+	for (int i = 0; i < len; i++) {
+		dst[i] = (uint8_t) (first + ((positions[cols[i]] +
+				CGIFH_HEATMAP_HALF) >> CGIFH_HEATMAP_FRAC_BITS));
+	}
+}
+
+/**
+ * Render a heat map row with ordered dither sampling.
+ *
+ * \param[out] dst       The image row span to render to.
+ * \param[in]  positions Palette positions for the grid row, by grid column.
+ * \param[in]  cols      Grid column for each pixel in the span.
+ * \param[in]  len       The length of the span in pixels.
+ * \param[in]  first     Palette index of the map's first palette entry.
+ * \param[in]  x         The x coordinate of the span in the image.
+ * \param[in]  y         The y coordinate of the span in the image.
+ */
+static void cgifh_heatmap_row_dither(
+		uint8_t *restrict dst,
+		const uint16_t *restrict positions,
+		const int *restrict cols,
+		int len,
+		uint8_t first,
+		int x,
+		int y)
+{
+	for (int i = 0; i < len; i++) {
+		unsigned p = positions[cols[i]];
+		unsigned frac = p & CGIFH_HEATMAP_FRAC_MASK;
+
+		dst[i] = (uint8_t) (first + (p >> CGIFH_HEATMAP_FRAC_BITS) +
+				(frac > cgifh_dither_threshold(x + i, y)));
+	}
+}
+
+/**
+ * Draw a heat map of a grid of values.
+ *
+ * Exactly one of fgrid and igrid must be non-NULL.
+ *
+ * \param[in] img    The image to draw the heat map in.
+ * \param[in] map    The value to palette mapping.
+ * \param[in] fgrid  The grid of floating point values, or NULL.
+ * \param[in] igrid  The grid of integer values, or NULL.
+ * \param[in] grid_w The grid width in cells.
+ * \param[in] grid_h The grid height in cells.
+ * \param[in] stride The number of values from the start of one grid row to
+ *                   the start of the next.
+ * \param[in] x      The x coordinate of the top left corner of the rectangle.
+ * \param[in] y      The y coordinate of the top left corner of the rectangle.
+ * \param[in] w      The width of the rectangle.
+ * \param[in] h      The height of the rectangle.
+ * \return true on success, false on memory allocation failure or if the
+ *         mapping is invalid.
+ */
+static bool cgifh_heatmap(
+		cgifh_t *img,
+		const cgifh_heatmap_t *map,
+		const float *fgrid,
+		const int32_t *igrid,
+		int grid_w,
+		int grid_h,
+		size_t stride,
+		int x, int y,
+		int w, int h)
+{
+	cgifh_heatmap_conv_t conv;
+	uint16_t *positions;
+	int x0 = (x < img->clip.x0) ? img->clip.x0 : x;
+	int y0 = (y < img->clip.y0) ? img->clip.y0 : y;
+	int x1 = (x + w > img->clip.x1) ? img->clip.x1 : x + w;
+	int y1 = (y + h > img->clip.y1) ? img->clip.y1 : y + h;
+	int prev_gy = -1;
+	int col_first;
+	int col_count;
+	int *cols;
+	int len;
+
+	if (!cgifh_heatmap_conv_init(map, &conv)) {
+		return false;
+	}
+
+	if (grid_w <= 0 || grid_h <= 0 || w <= 0 || h <= 0 ||
+	    x0 >= x1 || y0 >= y1) {
+		return true;
+	}
+
+	/* Only the grid columns that are visible need converting. */
+	len = x1 - x0;
+	col_first = (int) ((int64_t) (x0 - x) * grid_w / w);
+	col_count = (int) ((int64_t) (x1 - 1 - x) * grid_w / w) - col_first + 1;
+
+	cols = cgifh_scratch_alloc(img, (size_t) len * sizeof(*cols) +
+			(size_t) col_count * sizeof(*positions));
+	if (cols == NULL) {
+		return false;
+	}
+	positions = (uint16_t *) (void *) (cols + len);
+
+	for (int i = 0; i < len; i++) {
+		cols[i] = (int) ((int64_t) (x0 + i - x) * grid_w / w) -
+				col_first;
+	}
+
+	for (int row = y0; row < y1; row++) {
+		int gy = (int) (((int64_t) row - y) * grid_h / h);
+		uint8_t *dst = cgifh_row(img, row) + x0;
+		size_t offset = (size_t) gy * stride + (size_t) col_first;
+
+		if (gy == prev_gy && map->sample == CGIFH_HEATMAP_NEAREST) {
+			memcpy(dst, dst - img->width, (size_t) len);
+			continue;
+		}
+
+		if (gy != prev_gy) {
+			if (fgrid != NULL) {
+				cgifh_heatmap_positions_float(&conv,
+						fgrid + offset, col_count,
+						positions);
+			} else {
+				cgifh_heatmap_positions_int(&conv,
+						igrid + offset, col_count,
+						positions);
+			}
+			prev_gy = gy;
+		}
+
+		if (map->sample == CGIFH_HEATMAP_NEAREST) {
+			cgifh_heatmap_row_nearest(dst, positions, cols, len,
+					map->first);
+		} else {
+			cgifh_heatmap_row_dither(dst, positions, cols, len,
+					map->first, x0, row);
+		}
+	}
+
+	cgifh_scratch_free(img, cols);
+	return true;
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_heatmap_float(
+		cgifh_t *img,
+		const cgifh_heatmap_t *map,
+		const float *grid,
+		int grid_w,
+		int grid_h,
+		size_t stride,
+		int x, int y,
+		int w, int h)
+{
+	return cgifh_heatmap(img, map, grid, NULL,
+			grid_w, grid_h, stride, x, y, w, h);
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_heatmap_int(
+		cgifh_t *img,
+		const cgifh_heatmap_t *map,
+		const int32_t *grid,
+		int grid_w,
+		int grid_h,
+		size_t stride,
+		int x, int y,
+		int w, int h)
+{
+	return cgifh_heatmap(img, map, NULL, grid,
+			grid_w, grid_h, stride, x, y, w, h);
+}
@@ -0,0 +1,421 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Cached layers.
+ *
+ * A layer keeps the pixels from the last time its callback was called,
+ * along with a copy of everything they depend on. Only one set of pixels is
+ * kept, so the inputs are compared directly rather than hashed; the
+ * comparison costs no more than hashing would, and can't be fooled by a
+ * collision.
+ *
+ * Drawing never reads pixels, so the pixels a layer's callback touches can
+ * be found by drawing it over two different colours: pixels that differ
+ * between the two were left untouched.
+ */
+
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "ctx.h"
+
+/** Colours a non-opaque layer is drawn over to find its pixels. */
+enum {
+	CGIFH_LAYER_FILL_A = 0x00,
+	CGIFH_LAYER_FILL_B = 0xff,
+};
+
+/**
+ * Cached layer.
+ */
+struct cgifh_layer {
+	cgifh_ctx_t *ctx;  /**< Context the layer's memory comes from. */
+	cgifh_rect_t area; /**< The layer's area. */
+	bool opaque;       /**< Whether the layer draws every pixel. */
+
+	bool valid;        /**< Whether the cached pixels can be used. */
+	int width;         /**< Width of the image the pixels were drawn in. */
+	int height;        /**< Height of the image the pixels were drawn in. */
+	cgifh_rect_t clip; /**< Clip rectangle the pixels were drawn with. */
+	cgifh_rect_t drawn; /**< Part of the area the pixels cover. */
+
+	/** Palette the pixels were drawn with. */
+	uint8_t palette[CGIFH_CHANNEL_COUNT * CGIFH_PALETTE_MAX];
+	uint16_t palette_count; /**< Number of entries in the palette. */
+	/** Palette after drawing the pixels. */
+	uint8_t result[CGIFH_CHANNEL_COUNT * CGIFH_PALETTE_MAX];
+	uint16_t result_count; /**< Number of entries in the result palette. */
+
+	void *key;           /**< Key the pixels were drawn for. */
+	size_t key_size;     /**< Size of the key in bytes. */
+	size_t key_capacity; /**< Size of the key buffer in bytes. */
+
+	/** Cached pixels, followed by their mask if the layer isn't opaque
+	 * and any of it is visible. */
+	uint8_t *pixels;
+	size_t pixels_capacity; /**< Size of the pixel buffer in bytes. */
+};
+
+/**
+ * Get the part of a layer's area within an image's clip rectangle.
+ *
+ * \param[in] img   The image.
+ * \param[in] layer The layer.
+ * \return The visible part of the layer's area, which may be empty.
+ */
+static cgifh_rect_t cgifh_layer_visible(
+		const cgifh_t *img,
+		const cgifh_layer_t *layer)
+{
+	int64_t x1 = (int64_t) layer->area.x + layer->area.w;
+	int64_t y1 = (int64_t) layer->area.y + layer->area.h;
+	int x0 = layer->area.x;
+	int y0 = layer->area.y;
+
+	x0 = (x0 > img->clip.x0) ? x0 : img->clip.x0;
+	y0 = (y0 > img->clip.y0) ? y0 : img->clip.y0;
+	x1 = (x1 < img->clip.x1) ? x1 : img->clip.x1;
+	y1 = (y1 < img->clip.y1) ? y1 : img->clip.y1;
+	if (x0 >= x1 || y0 >= y1) {
+		return (cgifh_rect_t) { 0 };
+	}
+
+	return (cgifh_rect_t) {
+		.x = x0,
+		.y = y0,
+		.w = (int) x1 - x0,
+		.h = (int) y1 - y0,
+	};
+}
+
+/**
+ * Check whether a layer's cached pixels can be used.
+ *
+ * \param[in] img      The image being drawn into.
+ * \param[in] layer    The layer.
+ * \param[in] key      The layer's inputs.
+ * \param[in] key_size The size of the key in bytes.
+ * \return true if the cached pixels are what drawing would give.
+ */
+static bool cgifh_layer_unchanged(
+		const cgifh_t *img,
+		const cgifh_layer_t *layer,
+		const void *key,
+		size_t key_size)
+{
+	cgifh_rect_t clip = cgifh_clip_get(img);
+
+	return layer->valid &&
+	       layer->width == img->width &&
+	       layer->height == img->height &&
+	       layer->clip.x == clip.x && layer->clip.y == clip.y &&
+	       layer->clip.w == clip.w && layer->clip.h == clip.h &&
+	       layer->palette_count == img->palette_count &&
+	       memcmp(layer->palette, img->palette,
+			(size_t) CGIFH_CHANNEL_COUNT *
+			img->palette_count) == 0 &&
+	       layer->key_size == key_size &&
+	       (key_size == 0 || memcmp(layer->key, key, key_size) == 0);
+}
+
+/**
+ * Call a layer's draw callback with drawing confined to an area.
+ *
+ * \param[in] img  The image to draw into.
+ * \param[in] area The area to confine drawing to, within the clip rectangle.
+ * \param[in] draw The draw callback.
+ * \param[in] pw   Private data passed to the draw callback.
+ */
+static void cgifh_layer_call(
+		cgifh_t *img,
+		cgifh_rect_t area,
+		cgifh_draw_fn draw,
+		void *pw)
+{
+	cgifh_rect_t clip = cgifh_clip_get(img);
+	cgifh_rect_t bounds = {
+		.x = img->bounds.x0,
+		.y = img->bounds.y0,
+		.w = img->bounds.x1 - img->bounds.x0,
+		.h = img->bounds.y1 - img->bounds.y0,
+	};
+
+	img->clip.x0 = img->bounds.x0 = area.x;
+	img->clip.y0 = img->bounds.y0 = area.y;
+	img->clip.x1 = img->bounds.x1 = area.x + area.w;
+	img->clip.y1 = img->bounds.y1 = area.y + area.h;
+
+	draw(img, pw);
+
+	img->clip.x0 = clip.x;
+	img->clip.y0 = clip.y;
+	img->clip.x1 = clip.x + clip.w;
+	img->clip.y1 = clip.y + clip.h;
+	img->bounds.x0 = bounds.x;
+	img->bounds.y0 = bounds.y;
+	img->bounds.x1 = bounds.x + bounds.w;
+	img->bounds.y1 = bounds.y + bounds.h;
+}
+
+/**
+ * Copy an area of an image to a buffer.
+ *
+ * \param[in]  img  The image to copy from.
+ * \param[in]  area The area to copy, within the image.
+ * \param[out] dst  The buffer to copy to.
+ */
+static void cgifh_layer_read(
+		const cgifh_t *img,
+		cgifh_rect_t area,
+		uint8_t *dst)
+{
+	for (int row = 0; row < area.h; row++) {
+		memcpy(dst + (size_t) row * (size_t) area.w,
+				cgifh_row_const(img, area.y + row) + area.x,
+				(size_t) area.w);
+	}
+}
+
+/**
+ * Copy a buffer to an area of an image.
+ *
+ * \param[in] img  The image to copy to.
+ * \param[in] area The area to copy to, within the image.
+ * \param[in] src  The buffer to copy from.
+ * \param[in] mask Mask of the pixels to copy, 0xff for each pixel to copy
+ *                 and 0 otherwise, or NULL to copy them all.
+ */
+static void cgifh_layer_write(
+		cgifh_t *img,
+		cgifh_rect_t area,
+		const uint8_t *src,
+		const uint8_t *mask)
+{
+	size_t w = (size_t) area.w;
+
+	for (int row = 0; row < area.h; row++) {
+		uint8_t *dst = cgifh_row(img, area.y + row) + area.x;
+		const uint8_t *s = src + (size_t) row * w;
+
+		if (mask == NULL) {
+			memcpy(dst, s, w);
+			continue;
+		}
+
+		for (size_t i = 0; i < w; i++) {
+			uint8_t m = mask[(size_t) row * w + i];
+
+			dst[i] = (uint8_t) ((dst[i] & ~m) | (s[i] & m));
+		}
+	}
+}
+
+/**
+ * Make sure a layer's buffer is big enough.
+ *
+ * The buffer's contents are not kept when it grows.
+ *
+ * \param[in]     ctx      The context to allocate from, or NULL.
+ * \param[in]     buffer   The buffer, or NULL.
+ * \param[in,out] capacity The size of the buffer in bytes.
+ * \param[in]     size     The size needed in bytes.
+ * \return The buffer, or NULL on memory allocation failure.
+ */
+static void *cgifh_layer_reserve(
+		cgifh_ctx_t *ctx,
+		void *buffer,
+		size_t *capacity,
+		size_t size)
+{
+	if (size <= *capacity) {
+		return buffer;
+	}
+
+	cgifh_ctx_free(ctx, buffer);
+	*capacity = 0;
+	buffer = cgifh_ctx_alloc(ctx, size);
+	if (buffer != NULL) {
+		*capacity = size;
+	}
+
+	return buffer;
+}
+
+/**
+ * Draw a layer and cache the result.
+ *
+ * \param[in] img      The image to draw into.
+ * \param[in] layer    The layer.
+ * \param[in] area     The visible part of the layer's area.
+ * \param[in] key      The layer's inputs.
+ * \param[in] key_size The size of the key in bytes.
+ * \param[in] draw     The draw callback.
+ * \param[in] pw       Private data passed to the draw callback.
+ * \return true on success, false on memory allocation failure, in which
+ *         case nothing has been drawn.
+ */
+static bool cgifh_layer_record(
+		cgifh_t *img,
+		cgifh_layer_t *layer,
+		cgifh_rect_t area,
+		const void *key,
+		size_t key_size,
+		cgifh_draw_fn draw,
+		void *pw)
+{
+	size_t count = (size_t) area.w * (size_t) area.h;
+	bool masked = !layer->opaque && count > 0;
+	uint8_t *under = NULL;
+	uint8_t *mask;
+
+	layer->valid = false;
+	layer->key = cgifh_layer_reserve(layer->ctx, layer->key,
+			&layer->key_capacity, key_size);
+	layer->pixels = cgifh_layer_reserve(layer->ctx, layer->pixels,
+			&layer->pixels_capacity, masked ? 2 * count : count);
+	if ((layer->key == NULL && key_size > 0) ||
+	    (layer->pixels == NULL && count > 0)) {
+		return false;
+	}
+
+	if (masked) {
+		under = cgifh_scratch_alloc(img, count);
+		if (under == NULL) {
+			return false;
+		}
+	}
+
+	memcpy(layer->palette, img->palette, sizeof(layer->palette));
+	layer->palette_count = img->palette_count;
+
+	if (!masked) {
+		cgifh_layer_call(img, area, draw, pw);
+		cgifh_layer_read(img, area, layer->pixels);
+	} else {
+		mask = layer->pixels + count;
+		cgifh_layer_read(img, area, under);
+
+		cgifh_rect_fill(img, CGIFH_LAYER_FILL_A,
+				area.x, area.y, area.w, area.h);
+		cgifh_layer_call(img, area, draw, pw);
+		cgifh_layer_read(img, area, layer->pixels);
+
+		/* Draw it again from the same palette. */
+		memcpy(img->palette, layer->palette, sizeof(img->palette));
+		img->palette_count = layer->palette_count;
+
+		cgifh_rect_fill(img, CGIFH_LAYER_FILL_B,
+				area.x, area.y, area.w, area.h);
+		cgifh_layer_call(img, area, draw, pw);
+		cgifh_layer_read(img, area, mask);
+
+		for (size_t i = 0; i < count; i++) {
+			mask[i] = (mask[i] == layer->pixels[i]) ? 0xff : 0x00;
+		}
+
+		cgifh_layer_write(img, area, under, NULL);
+		cgifh_layer_write(img, area, layer->pixels, mask);
+		cgifh_scratch_free(img, under);
+	}
+
+	memcpy(layer->result, img->palette, sizeof(layer->result));
+	layer->result_count = img->palette_count;
+
+	if (key_size > 0) {
+		memcpy(layer->key, key, key_size);
+	}
+	layer->key_size = key_size;
+	layer->width = img->width;
+	layer->height = img->height;
+	layer->clip = cgifh_clip_get(img);
+	layer->drawn = area;
+	layer->valid = true;
+
+	return true;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_layer_t *cgifh_layer_create(
+		cgifh_ctx_t *ctx,
+		int x, int y,
+		int w, int h,
+		bool opaque)
+{
+	cgifh_layer_t *layer;
+
+	layer = cgifh_ctx_alloc(ctx, sizeof(*layer));
+	if (layer == NULL) {
+		return NULL;
+	}
+
+	*layer = (cgifh_layer_t) {
+		.ctx = ctx,
+		.area = {
+			.x = x,
+			.y = y,
+			.w = (w > 0) ? w : 0,
+			.h = (h > 0) ? h : 0,
+		},
+		.opaque = opaque,
+	};
+
+	return layer;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_layer_destroy(cgifh_layer_t *layer)
+{
+	if (layer == NULL) {
+		return;
+	}
+
+	cgifh_ctx_free(layer->ctx, layer->pixels);
+	cgifh_ctx_free(layer->ctx, layer->key);
+	cgifh_ctx_free(layer->ctx, layer);
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_layer_draw(
+		cgifh_t *img,
+		cgifh_layer_t *layer,
+		const void *key,
+		size_t key_size,
+		cgifh_draw_fn draw,
+		void *pw)
+{
+	cgifh_rect_t area;
+
+	if (cgifh_layer_unchanged(img, layer, key, key_size)) {
+		size_t count = (size_t) layer->drawn.w *
+				(size_t) layer->drawn.h;
+
+		if (count > 0) {
+			cgifh_layer_write(img, layer->drawn, layer->pixels,
+					layer->opaque ? NULL :
+					layer->pixels + count);
+		}
+		memcpy(img->palette, layer->result, sizeof(img->palette));
+		img->palette_count = layer->result_count;
+		if (img->ctx != NULL) {
+			img->ctx->stats.layer_hits++;
+		}
+		return true;
+	}
+
+	if (img->ctx != NULL) {
+		img->ctx->stats.layer_misses++;
+	}
+
+	area = cgifh_layer_visible(img, layer);
+	if (!cgifh_layer_record(img, layer, area, key, key_size, draw, pw)) {
+		cgifh_layer_call(img, area, draw, pw);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,1299 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Text layout.
+ *
+ * Layouts are built in a single allocation holding the layout, its lines,
+ * its glyphs and a copy of its text. They are reference counted, so a layout
+ * a caller holds stays valid after the cache evicts it.
+ *
+ * The cache is a hash table of layouts, threaded on a doubly linked list in
+ * order of use, so the least recently used layout can be evicted when the
+ * cache is full.
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "ctx.h"
+#include "font.h"
+
+/**
+ * Layout with its bookkeeping.
+ */
+typedef struct cgifh_layout_entry {
+	cgifh_layout_t layout; /**< The public layout. Must be first. */
+	unsigned refs;         /**< Number of references to the layout. */
+
+	uint64_t hash;    /**< Hash of the text and layout parameters. */
+	const char *text; /**< Copy of the text. */
+	cgifh_align_t align; /**< Alignment the text was laid out with. */
+	unsigned flags;   /**< Spacing flags the text was laid out with. */
+	int max_width;    /**< Width the text was wrapped to. */
+
+	struct cgifh_layout_entry *chain; /**< Next entry in hash bucket. */
+	struct cgifh_layout_entry *prev;  /**< More recently used entry. */
+	struct cgifh_layout_entry *next;  /**< Less recently used entry. */
+} cgifh_layout_entry_t;
+
+/**
+ * Text layout cache.
+ */
+struct cgifh_text_cache {
+	size_t capacity;     /**< Maximum number of entries. */
+	size_t count;        /**< Current number of entries. */
+	size_t bucket_count; /**< Number of hash buckets; a power of two. */
+	cgifh_layout_entry_t **buckets; /**< Hash buckets. */
+	cgifh_layout_entry_t *head;     /**< Most recently used entry. */
+	cgifh_layout_entry_t *tail;     /**< Least recently used entry. */
+	size_t hits;   /**< Number of lookups that found a layout. */
+	size_t misses; /**< Number of lookups that made a new layout. */
+};
+
+/**
+ * Clip rectangle, as half open ranges.
+ */
+typedef struct cgifh_layout_clip {
+	int x0; /**< Left edge. */
+	int y0; /**< Top edge. */
+	int x1; /**< Right edge, exclusive. */
+	int y1; /**< Bottom edge, exclusive. */
+} cgifh_layout_clip_t;
+
+/**
+ * Text style with defaults applied.
+ */
+typedef struct cgifh_layout_style {
+	const cgifh_font_t *font; /**< Font. */
+	int scale;                /**< Scale factor. */
+	cgifh_align_t align;      /**< Alignment. */
+	unsigned flags;           /**< Spacing flags. */
+	int mono;   /**< Advance of every glyph, or 0 for proportional. */
+	int figure; /**< Advance of every digit, or 0 for proportional. */
+	cgifh_text_effects_t effects; /**< Effects. */
+} cgifh_layout_style_t;
+
+/**
+ * Get the advance of a font's widest digit.
+ *
+ * \param[in] font The font.
+ * \return The advance of the widest digit, in unscaled pixels.
+ */
+static inline int cgifh_layout_figure_width(const cgifh_font_t *font)
+{
+	int width = 0;
+
+	/* Digits are ASCII, so every font has glyphs for them. */
+	for (uint32_t cp = '0'; cp <= '9'; cp++) {
+		int advance = cgifh_font_glyph(font, cp)->advance;
+
+		width = (advance > width) ? advance : width;
+	}
+
+	return width;
+}
+
+/**
+ * Apply defaults to a text style.
+ *
+ * \param[in] style The text style, or NULL.
+ * \return The style with defaults applied.
+ */
+static inline cgifh_layout_style_t cgifh_layout_style(
+		const cgifh_text_style_t *style)
+{
+	const cgifh_font_t *font;
+
+	if (style == NULL) {
+		return (cgifh_layout_style_t) {
+			.font = &cgifh_font_builtin,
+			.scale = 1,
+			.align = CGIFH_ALIGN_LEFT,
+		};
+	}
+
+	font = cgifh_font_get(style->font);
+	return (cgifh_layout_style_t) {
+		.font = font,
+		.scale = (style->scale < 1) ? 1 : style->scale,
+		.align = style->align,
+		.flags = style->flags,
+		.mono = (style->flags & CGIFH_TEXT_MONOSPACE) ?
+				font->width : 0,
+		.figure = (style->flags & CGIFH_TEXT_TABULAR) ?
+				cgifh_layout_figure_width(font) : 0,
+		.effects = style->effects,
+	};
+}
+
+/**
+ * Check whether two sets of text effects are the same.
+ *
+ * \param[in] a The first effects.
+ * \param[in] b The second effects.
+ * \return true if the effects are the same.
+ */
+static inline bool cgifh_layout_effects_equal(
+		const cgifh_text_effects_t *a,
+		const cgifh_text_effects_t *b)
+{
+	return a->flags == b->flags &&
+	       a->background == b->background &&
+	       a->outline == b->outline &&
+	       a->shadow == b->shadow;
+}
+
+/**
+ * Get the advance of a glyph, in unscaled pixels.
+ *
+ * Glyphs given a wider advance than their own by the style's spacing are
+ * centred within it. Spacing never narrows a glyph's advance, so glyphs
+ * never draw further past their advance than the font's overhang.
+ *
+ * \param[in]  style  The text style.
+ * \param[in]  glyph  The glyph, or NULL.
+ * \param[in]  cp     The glyph's code point.
+ * \param[out] offset Returns the offset of the glyph within its advance.
+ * \return The glyph's advance.
+ */
+static inline int cgifh_layout_advance(
+		const cgifh_layout_style_t *style,
+		const cgifh_glyph_t *glyph,
+		uint32_t cp,
+		int *offset)
+{
+	int advance = (glyph != NULL) ? glyph->advance : 0;
+	int cell = advance;
+
+	if (advance == 0) {
+		*offset = 0;
+		return 0;
+	} else if (style->mono != 0) {
+		cell = style->mono;
+	} else if (style->figure != 0 && cp >= '0' && cp <= '9') {
+		cell = style->figure;
+	}
+
+	if (cell < advance) {
+		cell = advance;
+	}
+
+	*offset = (cell - advance) / 2;
+	return cell;
+}
+
+/**
+ * Check whether a code point draws anything.
+ *
+ * \param[in] font The font.
+ * \param[in] cp   The code point.
+ * \return true if the code point's glyph has any pixels set.
+ */
+static inline bool cgifh_layout_visible(
+		const cgifh_font_t *font,
+		uint32_t cp)
+{
+	const cgifh_glyph_t *glyph = cgifh_font_glyph(font, cp);
+
+	return glyph != NULL && glyph->advance != 0 && glyph->span_count != 0;
+}
+
+/**
+ * Hash text and layout parameters.
+ *
+ * \param[in] text      The text.
+ * \param[in] style     The text style.
+ * \param[in] max_width The wrapping width.
+ * \return The hash.
+ */
+static uint64_t cgifh_layout_hash(
+		const char *text,
+		const cgifh_layout_style_t *style,
+		int max_width)
+{
+	/* FNV-1a. */
+	uint64_t hash = 0xcbf29ce484222325U;
+	const uint64_t prime = 0x100000001b3U;
+
+	while (*text != '\0') {
+		hash = (hash ^ (unsigned char) *text++) * prime;
+	}
+
+	hash = (hash ^ (uint64_t) (uintptr_t) style->font) * prime;
+	hash = (hash ^ (uint64_t) (unsigned) style->scale) * prime;
+	hash = (hash ^ (uint64_t) style->align) * prime;
+	hash = (hash ^ style->flags) * prime;
+	hash = (hash ^ style->effects.flags) * prime;
+	hash = (hash ^ (uint64_t) style->effects.background << 16 ^
+			(uint64_t) style->effects.outline << 8 ^
+			style->effects.shadow) * prime;
+	hash = (hash ^ (uint64_t) (unsigned) max_width) * prime;
+
+	return hash;
+}
+
+/**
+ * Find the end of the next line of text.
+ *
+ * Lines end at newlines, or when max_width is given, at the last space
+ * before the line would overflow. Words that don't fit on a line by
+ * themselves are broken. Spaces at the end of a line are dropped.
+ *
+ * \param[in]  start     The start of the line.
+ * \param[in]  style     The text style.
+ * \param[in]  max_width The wrapping width, or 0 for no wrapping.
+ * \param[out] end_out   Returns the end of the line's text.
+ * \param[out] width_out Returns the width of the line's text.
+ * \return The start of the following line, or NULL if this is the last line.
+ */
+static const char *cgifh_layout_break(
+		const char *start,
+		const cgifh_layout_style_t *style,
+		int max_width,
+		const char **end_out,
+		int *width_out)
+{
+	const char *space = NULL;
+	const char *p = start;
+	const char *next;
+	int space_width = 0;
+	int word_width = 0;
+	int width = 0;
+
+	while (*p != '\0' && *p != '\n') {
+		const char *q = p;
+		uint32_t cp = cgifh_utf8_next(&q);
+		int offset;
+		int advance = cgifh_layout_advance(style,
+				cgifh_font_glyph(style->font, cp),
+				cp, &offset) * style->scale;
+
+		if (cp == ' ') {
+			space = p;
+			space_width = word_width;
+		} else if (max_width > 0 && p > start &&
+				width + advance > max_width) {
+			break;
+		} else {
+			word_width = width + advance;
+		}
+		width += advance;
+		p = q;
+	}
+
+	if (*p == '\0' || *p == '\n') {
+		next = (*p == '\0') ? NULL : p + 1;
+
+	} else if (space != NULL) {
+		/* Wrap at the last space, dropping spaces around the break. */
+		next = space + 1;
+		while (*next == ' ') {
+			next++;
+		}
+		word_width = space_width;
+		p = space;
+
+	} else {
+		/* No space to wrap at; break the word. */
+		next = p;
+	}
+
+	while (p > start && p[-1] == ' ') {
+		p--;
+	}
+
+	*end_out = p;
+	*width_out = word_width;
+	return (next != NULL && *next == '\0') ? NULL : next;
+}
+
+/**
+ * Get the offset of a line within the width it is aligned to.
+ *
+ * \param[in] align      The alignment.
+ * \param[in] width      The width to align the line within.
+ * \param[in] line_width The width of the line.
+ * \return The x offset of the line.
+ */
+static inline int cgifh_layout_align(
+		cgifh_align_t align,
+		int width,
+		int line_width)
+{
+	switch (align) {
+	case CGIFH_ALIGN_CENTRE: return (width - line_width) / 2;
+	case CGIFH_ALIGN_RIGHT:  return width - line_width;
+	default:                 return 0;
+	}
+}
+
+/**
+ * Draw a glyph from its spans.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw glyph in.
+ * \param[in] glyph  Glyph to draw.
+ * \param[in] scale  Scale factor.
+ * \param[in] x      X coordinate to draw glyph at.
+ * \param[in] y      Y coordinate to draw glyph at.
+ * \param[in] clip   Clip rectangle, or NULL if the glyph is known to be
+ *                   entirely within the image.
+ */
+static inline void cgifh_layout_glyph(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_glyph_t *glyph,
+		int scale,
+		int x,
+		int y,
+		const cgifh_layout_clip_t *clip)
+{
+	const cgifh_glyph_span_t *span = glyph->spans;
+	const cgifh_glyph_span_t *end = span + glyph->span_count;
+
+	if (clip != NULL &&
+	    (x + glyph->box.x1 * scale <= clip->x0 ||
+	     x + glyph->box.x0 * scale >= clip->x1 ||
+	     y + glyph->box.y1 * scale <= clip->y0 ||
+	     y + glyph->box.y0 * scale >= clip->y1)) {
+		return;
+	}
+
+	for (; span < end; span++) {
+		int x0 = x + span->x0 * scale;
+		int x1 = x + span->x1 * scale;
+		int y0 = y + span->row * scale;
+		int y1 = y0 + scale;
+
+		if (clip != NULL) {
+			x0 = (x0 < clip->x0) ? clip->x0 : x0;
+			x1 = (x1 > clip->x1) ? clip->x1 : x1;
+			y0 = (y0 < clip->y0) ? clip->y0 : y0;
+			y1 = (y1 > clip->y1) ? clip->y1 : y1;
+			if (x0 >= x1 || y0 >= y1) {
+				continue;
+			}
+		}
+
+		for (int yy = y0; yy < y1; yy++) {
+			memset(cgifh_row(img, yy) + x0, colour,
+					(size_t) (x1 - x0));
+		}
+	}
+}
+
+/**
+ * Decide how to clip a line of text.
+ *
+ * \param[in]  clip    The clip rectangle.
+ * \param[in]  x       X coordinate of the line.
+ * \param[in]  y       Y coordinate of the line.
+ * \param[in]  width   Width of the line.
+ * \param[in]  height  Height of the line.
+ * \param[out] clipped Returns true if the line needs clipping.
+ * \return false if the line is entirely clipped out, true otherwise.
+ */
+static inline bool cgifh_layout_clip_line(
+		const cgifh_layout_clip_t *clip,
+		int x,
+		int y,
+		int width,
+		int height,
+		bool *clipped)
+{
+	if (x >= clip->x1 || x + width <= clip->x0 ||
+	    y >= clip->y1 || y + height <= clip->y0 ||
+	    width <= 0) {
+		return false;
+	}
+
+	*clipped = (x < clip->x0 || x + width > clip->x1 ||
+	            y < clip->y0 || y + height > clip->y1);
+	return true;
+}
+
+/**
+ * Draw a line of text.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] style  Text style.
+ * \param[in] text   Start of the line's text.
+ * \param[in] end    End of the line's text.
+ * \param[in] x      X coordinate of the line.
+ * \param[in] y      Y coordinate of the line.
+ * \param[in] width  Width of the line.
+ * \param[in] clip   Clip rectangle, within the image's clip rectangle.
+ */
+static void cgifh_layout_draw_line(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_layout_style_t *style,
+		const char *text,
+		const char *end,
+		int x,
+		int y,
+		int width,
+		const cgifh_layout_clip_t *clip)
+{
+	const cgifh_font_t *font = style->font;
+	int scale = style->scale;
+	bool clipped;
+
+	if (!cgifh_layout_clip_line(clip, x, y,
+			width + font->overhang * scale,
+			font->height * scale, &clipped)) {
+		return;
+	}
+
+	while (text < end) {
+		uint32_t cp = cgifh_utf8_next(&text);
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(font, cp);
+		int offset;
+		int advance = cgifh_layout_advance(style, glyph, cp, &offset);
+
+		if (glyph == NULL) {
+			continue;
+		}
+		if (clipped) {
+			cgifh_layout_glyph(img, colour, glyph, scale,
+					x + offset * scale, y, clip);
+		} else {
+			cgifh_layout_glyph(img, colour, glyph, scale,
+					x + offset * scale, y, NULL);
+		}
+		x += advance * scale;
+	}
+}
+
+/**
+ * Lay out text into a new layout entry.
+ *
+ * \param[in] text      The text.
+ * \param[in] style     The text style.
+ * \param[in] max_width The wrapping width, or 0 for no wrapping.
+ * \param[in] hash      Hash of the text and layout parameters.
+ * \return The new entry, with one reference, or NULL on failure.
+ */
+static cgifh_layout_entry_t *cgifh_layout_create(
+		const char *text,
+		const cgifh_layout_style_t *style,
+		int max_width,
+		uint64_t hash)
+{
+	size_t len = strlen(text);
+	cgifh_layout_entry_t *entry;
+	cgifh_layout_line_t *lines;
+	cgifh_layout_glyph_t *glyphs;
+	size_t line_count = 0;
+	size_t glyph_count = 0;
+	const cgifh_font_t *font = style->font;
+	int line_height = font->height * style->scale;
+	const char *p = text;
+	int width = 0;
+	char *copy;
+
+	/* There can't be more lines or glyphs than bytes of text, plus one
+	 * line for empty text. */
+	entry = malloc(sizeof(*entry) +
+			(len + 1) * sizeof(*lines) +
+			len * sizeof(*glyphs) +
+			len + 1);
+	if (entry == NULL) {
+		return NULL;
+	}
+	lines = (cgifh_layout_line_t *) (void *) (entry + 1);
+	glyphs = (cgifh_layout_glyph_t *) (void *) (lines + len + 1);
+	copy = (char *) (glyphs + len);
+	memcpy(copy, text, len + 1);
+
+	while (p != NULL) {
+		cgifh_layout_line_t *line = &lines[line_count];
+		const char *end;
+		const char *next;
+		int x = 0;
+
+		next = cgifh_layout_break(p, style, max_width, &end, &line->width);
+		line->y = (int) line_count * line_height;
+		line->first = glyph_count;
+		while (p < end) {
+			uint32_t cp = cgifh_utf8_next(&p);
+			int offset;
+			int advance = cgifh_layout_advance(style,
+					cgifh_font_glyph(font, cp), cp, &offset);
+
+			if (cgifh_layout_visible(font, cp)) {
+				glyphs[glyph_count++] = (cgifh_layout_glyph_t) {
+					.x = x + offset * style->scale,
+					.y = line->y,
+					.codepoint = cp,
+				};
+			}
+			x += advance * style->scale;
+		}
+		line->count = glyph_count - line->first;
+		width = (line->width > width) ? line->width : width;
+
+		line_count++;
+		p = next;
+	}
+
+	if (max_width > 0) {
+		width = max_width;
+	}
+
+	for (size_t i = 0; i < line_count; i++) {
+		cgifh_layout_line_t *line = &lines[i];
+
+		line->x = cgifh_layout_align(style->align, width, line->width);
+		for (size_t g = line->first; g < line->first + line->count; g++) {
+			glyphs[g].x += line->x;
+		}
+	}
+
+	*entry = (cgifh_layout_entry_t) {
+		.layout = {
+			.width = width,
+			.height = (int) line_count * line_height,
+			.font = font,
+			.scale = style->scale,
+			.effects = style->effects,
+			.line_count = line_count,
+			.glyph_count = glyph_count,
+			.lines = lines,
+			.glyphs = glyphs,
+		},
+		.refs = 1,
+		.hash = hash,
+		.text = copy,
+		.align = style->align,
+		.flags = style->flags,
+		.max_width = max_width,
+	};
+
+	return entry;
+}
+
+/**
+ * Unlink an entry from the cache's use order list.
+ *
+ * \param[in] cache The cache.
+ * \param[in] entry The entry to unlink.
+ */
+static void cgifh_text_cache_unlink(
+		cgifh_text_cache_t *cache,
+		cgifh_layout_entry_t *entry)
+{
+	if (entry->prev != NULL) {
+		entry->prev->next = entry->next;
+	} else {
+		cache->head = entry->next;
+	}
+
+	if (entry->next != NULL) {
+		entry->next->prev = entry->prev;
+	} else {
+		cache->tail = entry->prev;
+	}
+}
+
+/**
+ * Link an entry at the front of the cache's use order list.
+ *
+ * \param[in] cache The cache.
+ * \param[in] entry The entry to link.
+ */
+static void cgifh_text_cache_link(
+		cgifh_text_cache_t *cache,
+		cgifh_layout_entry_t *entry)
+{
+	entry->prev = NULL;
+	entry->next = cache->head;
+	if (cache->head != NULL) {
+		cache->head->prev = entry;
+	} else {
+		cache->tail = entry;
+	}
+	cache->head = entry;
+}
+
+/**
+ * Evict the least recently used entry from the cache.
+ *
+ * \param[in] cache The cache.
+ */
+static void cgifh_text_cache_evict(cgifh_text_cache_t *cache)
+{
+	cgifh_layout_entry_t *entry = cache->tail;
+	cgifh_layout_entry_t **link;
+
+	link = &cache->buckets[entry->hash & (cache->bucket_count - 1)];
+	while (*link != entry) {
+		link = &(*link)->chain;
+	}
+	*link = entry->chain;
+
+	cgifh_text_cache_unlink(cache, entry);
+	cache->count--;
+
+	cgifh_layout_release(&entry->layout);
+}
+
+/* Exported function, documented in cgifh.h */
+int cgifh_font_height(const cgifh_font_t *font)
+{
+	return cgifh_font_get(font)->height;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_text_cache_t *cgifh_text_cache_create(size_t capacity)
+{
+	cgifh_text_cache_t *cache;
+	size_t bucket_count = 1;
+
+	if (capacity == 0) {
+		return NULL;
+	}
+
+	while (bucket_count < capacity) {
+		bucket_count *= 2;
+	}
+
+	cache = malloc(sizeof(*cache));
+	if (cache == NULL) {
+		return NULL;
+	}
+
+	cache->buckets = calloc(bucket_count, sizeof(*cache->buckets));
+	if (cache->buckets == NULL) {
+		free(cache);
+		return NULL;
+	}
+
+	cache->capacity = capacity;
+	cache->count = 0;
+	cache->bucket_count = bucket_count;
+	cache->head = NULL;
+	cache->tail = NULL;
+	cache->hits = 0;
+	cache->misses = 0;
+
+	return cache;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_text_cache_destroy(cgifh_text_cache_t *cache)
+{
+	if (cache == NULL) {
+		return;
+	}
+
+	while (cache->count > 0) {
+		cgifh_text_cache_evict(cache);
+	}
+
+	free(cache->buckets);
+	free(cache);
+}
+
+/* Exported function, documented in cgifh.h */
+const cgifh_layout_t *cgifh_text_layout(
+		cgifh_text_cache_t *cache,
+		const cgifh_text_style_t *style,
+		const char *text,
+		int max_width)
+{
+	cgifh_layout_style_t resolved = cgifh_layout_style(style);
+	cgifh_layout_entry_t **bucket;
+	cgifh_layout_entry_t *entry;
+	uint64_t hash;
+
+	if (max_width < 0) {
+		max_width = 0;
+	}
+	hash = cgifh_layout_hash(text, &resolved, max_width);
+
+	if (cache == NULL) {
+		entry = cgifh_layout_create(text, &resolved, max_width, hash);
+		return (entry != NULL) ? &entry->layout : NULL;
+	}
+
+	bucket = &cache->buckets[hash & (cache->bucket_count - 1)];
+	for (entry = *bucket; entry != NULL; entry = entry->chain) {
+		if (entry->hash == hash &&
+		    entry->layout.font == resolved.font &&
+		    entry->layout.scale == resolved.scale &&
+		    entry->align == resolved.align &&
+		    entry->flags == resolved.flags &&
+		    cgifh_layout_effects_equal(&entry->layout.effects,
+				&resolved.effects) &&
+		    entry->max_width == max_width &&
+		    strcmp(entry->text, text) == 0) {
+			cgifh_text_cache_unlink(cache, entry);
+			cgifh_text_cache_link(cache, entry);
+			cache->hits++;
+			entry->refs++;
+			return &entry->layout;
+		}
+	}
+
+	cache->misses++;
+
+	entry = cgifh_layout_create(text, &resolved, max_width, hash);
+	if (entry == NULL) {
+		return NULL;
+	}
+
+	if (cache->count == cache->capacity) {
+		cgifh_text_cache_evict(cache);
+	}
+
+	/* The cache holds its own reference. */
+	entry->refs++;
+	entry->chain = *bucket;
+	*bucket = entry;
+	cgifh_text_cache_link(cache, entry);
+	cache->count++;
+
+	return &entry->layout;
+}
+
+/* Internal function, documented in ctx.h */
+void cgifh_text_cache_counts(
+		const cgifh_text_cache_t *cache,
+		size_t *hits,
+		size_t *misses)
+{
+	*hits = cache->hits;
+	*misses = cache->misses;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_layout_release(const cgifh_layout_t *layout)
+{
+	/* The layout is the first member of its entry. */
+	cgifh_layout_entry_t *entry = (cgifh_layout_entry_t *) (void *) layout;
+
+	if (entry == NULL) {
+		return;
+	}
+
+	if (--entry->refs == 0) {
+		free(entry);
+	}
+}
+
+/**
+ * Draw laid out text with its effects.
+ *
+ * The glyphs are rendered into a mask covering the part of the text's
+ * extent within the clip rectangle, with a margin for the effects to
+ * sample. Each pixel of the extent is then written once, with the text,
+ * outline, shadow or background colour, in that order of precedence.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] layout Layout to draw.
+ * \param[in] x      X coordinate to draw the layout's origin at.
+ * \param[in] y      Y coordinate to draw the layout's origin at.
+ * \param[in] clip   Clip rectangle, within the image's clip rectangle.
+ * \return false on memory allocation failure, true otherwise.
+ */
+static bool cgifh_layout_draw_effects(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_layout_t *layout,
+		int x,
+		int y,
+		const cgifh_layout_clip_t *clip)
+{
+	const cgifh_text_effects_t *effects = &layout->effects;
+	const cgifh_font_t *font = layout->font;
+	int overhang = font->overhang * layout->scale;
+	int height = font->height * layout->scale;
+	bool background = (effects->flags & CGIFH_TEXT_BACKGROUND) != 0;
+	int outline = (effects->flags & CGIFH_TEXT_OUTLINE) ? 1 : 0;
+	int shadow = (effects->flags & CGIFH_TEXT_SHADOW) ? layout->scale : 0;
+	int margin = outline + shadow;
+	cgifh_layout_clip_t area = {
+		.x0 = x - outline,
+		.y0 = y - outline,
+		.x1 = x + layout->width + overhang + outline + shadow,
+		.y1 = y + layout->height + outline + shadow,
+	};
+	cgifh_layout_clip_t bounds;
+	cgifh_t *mask;
+	size_t mask_w;
+	size_t mask_h;
+	int ox;
+	int oy;
+
+	if (!background && layout->line_count > 0) {
+		/* Only the lines' extent can have effects drawn. */
+		int x0 = INT_MAX;
+		int x1 = INT_MIN;
+
+		for (size_t i = 0; i < layout->line_count; i++) {
+			const cgifh_layout_line_t *line = &layout->lines[i];
+
+			x0 = (line->x < x0) ? line->x : x0;
+			x1 = (line->x + line->width > x1) ?
+					line->x + line->width : x1;
+		}
+		area.x0 = x + x0 - outline;
+		area.x1 = x + x1 + overhang + outline + shadow;
+	}
+
+	area.x0 = (area.x0 > clip->x0) ? area.x0 : clip->x0;
+	area.y0 = (area.y0 > clip->y0) ? area.y0 : clip->y0;
+	area.x1 = (area.x1 < clip->x1) ? area.x1 : clip->x1;
+	area.y1 = (area.y1 < clip->y1) ? area.y1 : clip->y1;
+	if (area.x0 >= area.x1 || area.y0 >= area.y1) {
+		return true;
+	}
+
+	mask_w = (size_t) (area.x1 - area.x0 + 2 * margin);
+	mask_h = (size_t) (area.y1 - area.y0 + 2 * margin);
+	mask = cgifh_scratch_alloc(img, sizeof(*mask) + mask_w * mask_h);
+	if (mask == NULL) {
+		return false;
+	}
+	cgifh_image_init(mask, NULL, mask_w, mask_h);
+	cgifh_clear(mask, 0);
+	bounds = (cgifh_layout_clip_t) {
+		.x1 = mask->width,
+		.y1 = mask->height,
+	};
+	ox = area.x0 - margin;
+	oy = area.y0 - margin;
+
+	for (size_t i = 0; i < layout->line_count; i++) {
+		const cgifh_layout_line_t *line = &layout->lines[i];
+		const cgifh_layout_glyph_t *glyph = &layout->glyphs[line->first];
+		bool clipped;
+
+		if (!cgifh_layout_clip_line(&bounds,
+				x + line->x - ox, y + line->y - oy,
+				line->width + overhang, height, &clipped)) {
+			continue;
+		}
+
+		for (size_t g = 0; g < line->count; g++, glyph++) {
+			cgifh_layout_glyph(mask, 1,
+					cgifh_font_glyph(font, glyph->codepoint),
+					layout->scale,
+					x + glyph->x - ox, y + glyph->y - oy,
+					clipped ? &bounds : NULL);
+		}
+	}
+
+	for (int yy = area.y0; yy < area.y1; yy++) {
+		const uint8_t *text = cgifh_row(mask, yy - oy);
+		const uint8_t *above = cgifh_row(mask, yy - oy - outline);
+		const uint8_t *below = cgifh_row(mask, yy - oy + outline);
+		const uint8_t *cast = cgifh_row(mask, yy - oy - shadow);
+		uint8_t *row = cgifh_row(img, yy);
+
+		for (int xx = area.x0; xx < area.x1; xx++) {
+			int mx = xx - ox;
+
+			if (text[mx]) {
+				row[xx] = colour;
+			} else if (outline &&
+			           (above[mx - 1] | above[mx] | above[mx + 1] |
+			            text[mx - 1] | text[mx + 1] |
+			            below[mx - 1] | below[mx] | below[mx + 1])) {
+				row[xx] = effects->outline;
+			} else if (shadow && cast[mx - shadow]) {
+				row[xx] = effects->shadow;
+			} else if (background) {
+				row[xx] = effects->background;
+			}
+		}
+	}
+
+	cgifh_scratch_free(img, mask);
+	return true;
+}
+
+/**
+ * Draw laid out text, clipped to a rectangle.
+ *
+ * \param[in] img    Image to draw on.
+ * \param[in] colour Colour to draw text in.
+ * \param[in] layout Layout to draw.
+ * \param[in] x      X coordinate to draw the layout's origin at.
+ * \param[in] y      Y coordinate to draw the layout's origin at.
+ * \param[in] clip   Clip rectangle, within the image's clip rectangle.
+ */
+static void cgifh_layout_draw_clipped(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_layout_t *layout,
+		int x,
+		int y,
+		const cgifh_layout_clip_t *clip)
+{
+	const cgifh_font_t *font = layout->font;
+	int overhang = font->overhang * layout->scale;
+	int height = font->height * layout->scale;
+
+	/* Without memory for the effects, the text is still drawn. */
+	if (layout->effects.flags != 0 &&
+	    cgifh_layout_draw_effects(img, colour, layout, x, y, clip)) {
+		return;
+	}
+
+	for (size_t i = 0; i < layout->line_count; i++) {
+		const cgifh_layout_line_t *line = &layout->lines[i];
+		const cgifh_layout_glyph_t *glyph = &layout->glyphs[line->first];
+		bool clipped;
+
+		if (!cgifh_layout_clip_line(clip, x + line->x, y + line->y,
+				line->width + overhang, height, &clipped)) {
+			continue;
+		}
+
+		for (size_t g = 0; g < line->count; g++, glyph++) {
+			cgifh_layout_glyph(img, colour,
+					cgifh_font_glyph(font, glyph->codepoint),
+					layout->scale, x + glyph->x, y + glyph->y,
+					clipped ? clip : NULL);
+		}
+	}
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_layout_draw(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_layout_t *layout,
+		int x,
+		int y)
+{
+	const cgifh_layout_clip_t clip = {
+		.x0 = img->clip.x0,
+		.y0 = img->clip.y0,
+		.x1 = img->clip.x1,
+		.y1 = img->clip.y1,
+	};
+
+	cgifh_layout_draw_clipped(img, colour, layout, x, y, &clip);
+}
+
+/* Exported function, documented in cgifh.h */
+int cgifh_text_box(
+		cgifh_t *img,
+		uint8_t colour,
+		const cgifh_text_style_t *style,
+		const char *text,
+		int x,
+		int y,
+		int w,
+		int h)
+{
+	cgifh_layout_style_t resolved = cgifh_layout_style(style);
+	int line_height = resolved.font->height * resolved.scale;
+	cgifh_layout_clip_t clip = {
+		.x0 = (x > img->clip.x0) ? x : img->clip.x0,
+		.y0 = (y > img->clip.y0) ? y : img->clip.y0,
+		.x1 = (x + w < img->clip.x1) ? x + w : img->clip.x1,
+		.y1 = (y + h < img->clip.y1) ? y + h : img->clip.y1,
+	};
+	int line_y = y;
+
+	if (w < 0) {
+		w = 0;
+	}
+
+	if (resolved.effects.flags != 0) {
+		/* Effects need the whole text's extent, so lay it out first. */
+		cgifh_layout_entry_t *entry = cgifh_layout_create(text,
+				&resolved, w, 0);
+
+		if (entry != NULL) {
+			int height = entry->layout.height;
+
+			cgifh_layout_draw_clipped(img, colour, &entry->layout,
+					x, y, &clip);
+			cgifh_layout_release(&entry->layout);
+			return height;
+		}
+	}
+
+	while (text != NULL) {
+		const char *end;
+		const char *next;
+		int width;
+
+		next = cgifh_layout_break(text, &resolved, w, &end, &width);
+		if (line_y < clip.y1) {
+			cgifh_layout_draw_line(img, colour, &resolved,
+					text, end,
+					x + cgifh_layout_align(resolved.align,
+							w, width),
+					line_y, width, &clip);
+		}
+		line_y += line_height;
+		text = next;
+	}
+
+	return line_y - y;
+}
+
+/**
+ * Add an area to a list of changed areas of laid out text.
+ *
+ * The area is grown by the margin the layout's effects draw around text,
+ * and merged with the last area in the list where they overlap on the
+ * same rows.
+ *
+ * \param[in]     layout The layout the area is from.
+ * \param[in,out] areas  The list of changed areas.
+ * \param[in,out] count  The number of areas in the list.
+ * \param[in]     area   The area to add.
+ */
+static void cgifh_layout_changed(
+		const cgifh_layout_t *layout,
+		cgifh_layout_clip_t *areas,
+		size_t *count,
+		cgifh_layout_clip_t area)
+{
+	unsigned flags = layout->effects.flags;
+	int outline = (flags & CGIFH_TEXT_OUTLINE) ? 1 : 0;
+	int shadow = (flags & CGIFH_TEXT_SHADOW) ? layout->scale : 0;
+
+	area.x0 -= outline;
+	area.y0 -= outline;
+	area.x1 += outline + shadow;
+	area.y1 += outline + shadow;
+
+	if (*count > 0) {
+		cgifh_layout_clip_t *last = &areas[*count - 1];
+
+		if (area.y0 == last->y0 && area.y1 == last->y1 &&
+		    area.x0 <= last->x1 && area.x1 >= last->x0) {
+			last->x0 = (area.x0 < last->x0) ? area.x0 : last->x0;
+			last->x1 = (area.x1 > last->x1) ? area.x1 : last->x1;
+			return;
+		}
+	}
+
+	areas[(*count)++] = area;
+}
+
+/**
+ * Add the area a laid out glyph draws to to a list of changed areas.
+ *
+ * \param[in]     layout The layout the glyph is from.
+ * \param[in]     glyph  The glyph.
+ * \param[in]     x      X coordinate of the layout's origin.
+ * \param[in]     y      Y coordinate of the layout's origin.
+ * \param[in,out] areas  The list of changed areas.
+ * \param[in,out] count  The number of areas in the list.
+ */
+static void cgifh_layout_changed_glyph(
+		const cgifh_layout_t *layout,
+		const cgifh_layout_glyph_t *glyph,
+		int x,
+		int y,
+		cgifh_layout_clip_t *areas,
+		size_t *count)
+{
+	const cgifh_glyph_box_t *box = &cgifh_font_glyph(layout->font,
+			glyph->codepoint)->box;
+
+	/* Areas span the whole line, so changes on a line merge. */
+	cgifh_layout_changed(layout, areas, count, (cgifh_layout_clip_t) {
+		.x0 = x + glyph->x + box->x0 * layout->scale,
+		.y0 = y + glyph->y,
+		.x1 = x + glyph->x + box->x1 * layout->scale,
+		.y1 = y + glyph->y + layout->font->height * layout->scale,
+	});
+}
+
+/**
+ * Find the areas that differ between two layouts drawn at a position.
+ *
+ * The layouts must have the same font, scale and effects.
+ *
+ * \param[in]  old   The layout drawn at the position.
+ * \param[in]  new   The layout to draw at the position.
+ * \param[in]  x     X coordinate of the layouts' origin.
+ * \param[in]  y     Y coordinate of the layouts' origin.
+ * \param[out] areas Returns the changed areas. Must have space for an area
+ *                   for every glyph of both layouts, and two more.
+ * \return The number of changed areas.
+ */
+static size_t cgifh_layout_diff(
+		const cgifh_layout_t *old,
+		const cgifh_layout_t *new,
+		int x,
+		int y,
+		cgifh_layout_clip_t *areas)
+{
+	int overhang = new->font->overhang * new->scale;
+	size_t count = 0;
+	size_t o = 0;
+	size_t n = 0;
+
+	/* Glyphs are in order of line, then position on the line, so glyphs
+	 * drawn the same in both layouts are found by merging them. */
+	while (o < old->glyph_count || n < new->glyph_count) {
+		const cgifh_layout_glyph_t *og = &old->glyphs[o];
+		const cgifh_layout_glyph_t *ng = &new->glyphs[n];
+
+		if (n == new->glyph_count ||
+		    (o < old->glyph_count &&
+		     (og->y < ng->y || (og->y == ng->y && og->x < ng->x)))) {
+			cgifh_layout_changed_glyph(old, og, x, y, areas, &count);
+			o++;
+
+		} else if (o == old->glyph_count ||
+		           og->y != ng->y || og->x != ng->x) {
+			cgifh_layout_changed_glyph(new, ng, x, y, areas, &count);
+			n++;
+
+		} else {
+			if (og->codepoint != ng->codepoint) {
+				cgifh_layout_changed_glyph(old, og, x, y,
+						areas, &count);
+				cgifh_layout_changed_glyph(new, ng, x, y,
+						areas, &count);
+			}
+			o++;
+			n++;
+		}
+	}
+
+	if ((new->effects.flags & CGIFH_TEXT_BACKGROUND) &&
+	    (old->width != new->width || old->height != new->height)) {
+		/* The background covers the layout box, which has changed. */
+		int w0 = (old->width < new->width) ? old->width : new->width;
+		int w1 = (old->width > new->width) ? old->width : new->width;
+		int h0 = (old->height < new->height) ? old->height : new->height;
+		int h1 = (old->height > new->height) ? old->height : new->height;
+
+		cgifh_layout_changed(new, areas, &count, (cgifh_layout_clip_t) {
+			.x0 = x + w0 + overhang,
+			.y0 = y,
+			.x1 = x + w1 + overhang,
+			.y1 = y + h1,
+		});
+		cgifh_layout_changed(new, areas, &count, (cgifh_layout_clip_t) {
+			.x0 = x,
+			.y0 = y + h0,
+			.x1 = x + w1 + overhang,
+			.y1 = y + h1,
+		});
+	}
+
+	return count;
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_text_update(
+		cgifh_t *img,
+		uint8_t colour,
+		uint8_t background,
+		const cgifh_text_style_t *style,
+		const char *old_text,
+		const char *new_text,
+		int x,
+		int y,
+		cgifh_rect_t *changed)
+{
+	cgifh_layout_style_t resolved = cgifh_layout_style(style);
+	cgifh_layout_clip_t bounds = { .x0 = INT_MAX, .y0 = INT_MAX };
+	cgifh_layout_entry_t *old = NULL;
+	cgifh_layout_entry_t *new;
+	cgifh_layout_clip_t *areas;
+	size_t count = 0;
+	bool ok = false;
+
+	if (changed != NULL) {
+		*changed = (cgifh_rect_t) { 0 };
+	}
+
+	new = cgifh_layout_create(new_text, &resolved, 0, 0);
+	if (new == NULL) {
+		return false;
+	}
+	if (old_text != NULL) {
+		old = cgifh_layout_create(old_text, &resolved, 0, 0);
+		if (old == NULL) {
+			goto cleanup;
+		}
+	}
+
+	/* Drawing effects uses the working memory, so this doesn't. */
+	areas = cgifh_ctx_alloc(img->ctx, (((old != NULL) ?
+			old->layout.glyph_count : 0) +
+			new->layout.glyph_count + 2) * sizeof(*areas));
+	if (areas == NULL) {
+		goto cleanup;
+	}
+
+	if (old != NULL) {
+		count = cgifh_layout_diff(&old->layout, &new->layout,
+				x, y, areas);
+	} else {
+		/* Without old text, everything the new text draws changes. */
+		cgifh_layout_changed(&new->layout, areas, &count,
+				(cgifh_layout_clip_t) {
+			.x0 = x,
+			.y0 = y,
+			.x1 = x + new->layout.width +
+					resolved.font->overhang * resolved.scale,
+			.y1 = y + new->layout.height,
+		});
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		cgifh_layout_clip_t clip = areas[i];
+
+		clip.x0 = (clip.x0 > img->clip.x0) ? clip.x0 : img->clip.x0;
+		clip.y0 = (clip.y0 > img->clip.y0) ? clip.y0 : img->clip.y0;
+		clip.x1 = (clip.x1 < img->clip.x1) ? clip.x1 : img->clip.x1;
+		clip.y1 = (clip.y1 < img->clip.y1) ? clip.y1 : img->clip.y1;
+		if (clip.x0 >= clip.x1 || clip.y0 >= clip.y1) {
+			continue;
+		}
+
+		for (int yy = clip.y0; yy < clip.y1; yy++) {
+			memset(cgifh_row(img, yy) + clip.x0, background,
+					(size_t) (clip.x1 - clip.x0));
+		}
+		cgifh_layout_draw_clipped(img, colour, &new->layout,
+				x, y, &clip);
+
+		bounds.x0 = (clip.x0 < bounds.x0) ? clip.x0 : bounds.x0;
+		bounds.y0 = (clip.y0 < bounds.y0) ? clip.y0 : bounds.y0;
+		bounds.x1 = (clip.x1 > bounds.x1) ? clip.x1 : bounds.x1;
+		bounds.y1 = (clip.y1 > bounds.y1) ? clip.y1 : bounds.y1;
+	}
+	cgifh_ctx_free(img->ctx, areas);
+
+	if (changed != NULL && bounds.x0 < bounds.x1) {
+		*changed = (cgifh_rect_t) {
+			.x = bounds.x0,
+			.y = bounds.y0,
+			.w = bounds.x1 - bounds.x0,
+			.h = bounds.y1 - bounds.y0,
+		};
+	}
+	ok = true;
+
+cleanup:
+	if (old != NULL) {
+		cgifh_layout_release(&old->layout);
+	}
+	cgifh_layout_release(&new->layout);
+	return ok;
+}
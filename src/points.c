@@ -0,0 +1,269 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Batched point drawing.
+ */
+
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "ctx.h"
+
+/**
+ * Minimum number of visible points for sorting them by row to be worthwhile.
+ */
+#define CGIFH_POINTS_SORT_MIN 256
+
+/**
+ * Draw a single marker.
+ *
+ * \param[in] img    The image to draw the marker in.
+ * \param[in] colour The palette index to draw the marker in.
+ * \param[in] marker The marker shape.
+ * \param[in] x      The x coordinate of the marker's point.
+ * \param[in] y      The y coordinate of the marker's point.
+ * \param[in] before The marker's extent left of and above its point.
+ * \param[in] after  The marker's extent right of and below its point.
+ */
+static void cgifh_points_marker(
+		cgifh_t *img,
+		uint8_t colour,
+		cgifh_marker_t marker,
+		int x,
+		int y,
+		int before,
+		int after)
+{
+	switch (marker) {
+	case CGIFH_MARKER_SQUARE:
+		cgifh_rect_fill(img, colour, x - before, y - before,
+				before + after + 1, before + after + 1);
+		break;
+
+	case CGIFH_MARKER_PLUS:
+		cgifh_h_line(img, colour, x - before, x + after, y);
+		cgifh_v_line(img, colour, y - before, y + after, x);
+		break;
+
+	case CGIFH_MARKER_CROSS:
+		cgifh_line(img, colour,
+				x - before, y - before,
+				x + after, y + after);
+		cgifh_line(img, colour,
+				x - before, y + after,
+				x + after, y - before);
+		break;
+	}
+}
+
+/**
+ * Find which points have markers that are at least partly in the clip
+ * rectangle.
+ *
+ * This is written without branches so that the compiler vectorises it.
+ *
+ * \param[in]  img     The image to clip against.
+ * \param[in]  xs      Array of point x coordinates.
+ * \param[in]  ys      Array of point y coordinates.
+ * \param[in]  count   The number of points.
+ * \param[in]  before  The marker extent left of and above each point.
+ * \param[in]  after   The marker extent right of and below each point.
+ * \param[out] visible Array to receive 1 for visible points and 0 otherwise.
+ */
+static void cgifh_points_clip(
+		const cgifh_t *img,
+		const int *restrict xs,
+		const int *restrict ys,
+		size_t count,
+		int before,
+		int after,
+		uint8_t *restrict visible)
+{
+	/* The range test of cgifh_pixel_in_clip, with the clip rectangle
+	 * grown by the marker extents. */
+	unsigned span_x = (unsigned) (img->clip.x1 - img->clip.x0) +
+			(unsigned) (before + after);
+	unsigned span_y = (unsigned) (img->clip.y1 - img->clip.y0) +
+			(unsigned) (before + after);
+	unsigned base_x = (unsigned) img->clip.x0 - (unsigned) after;
+	unsigned base_y = (unsigned) img->clip.y0 - (unsigned) after;
+
+	for (size_t i = 0; i < count; i++) {
+		unsigned x = (unsigned) xs[i] - base_x;
+		unsigned y = (unsigned) ys[i] - base_y;
+
+		visible[i] = (uint8_t) ((x < span_x) & (y < span_y));
+	}
+}
+
+/**
+ * Sort visible points by the first image row their markers touch.
+ *
+ * This is a stable counting sort, so points on the same row keep their
+ * relative order.
+ *
+ * \param[in]  img     The image the points are drawn in.
+ * \param[in]  ys      Array of point y coordinates.
+ * \param[in]  visible Array of point visibility, from \ref cgifh_points_clip.
+ * \param[in]  count   The number of points.
+ * \param[in]  before  The marker extent above each point.
+ * \param[in]  rows    Array of one more than the image height row counts.
+ * \param[out] order   Array to receive the sorted visible point indexes.
+ */
+static void cgifh_points_sort(
+		const cgifh_t *img,
+		const int *ys,
+		const uint8_t *visible,
+		size_t count,
+		int before,
+		size_t *rows,
+		size_t *order)
+{
+	memset(rows, 0, ((size_t) img->height + 1) * sizeof(*rows));
+
+	for (size_t i = 0; i < count; i++) {
+		if (visible[i]) {
+			int row = (ys[i] - before < 0) ? 0 : ys[i] - before;
+
+			rows[row + 1]++;
+		}
+	}
+
+	for (int row = 0; row < img->height; row++) {
+		rows[row + 1] += rows[row];
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (visible[i]) {
+			int row = (ys[i] - before < 0) ? 0 : ys[i] - before;
+
+			order[rows[row]++] = i;
+		}
+	}
+}
+
+/**
+ * Draw points, in the given order.
+ *
+ * \param[in] img     The image to draw the points in.
+ * \param[in] colour  The palette index to draw points in, if colours is NULL.
+ * \param[in] colours Array of per-point palette indexes, or NULL.
+ * \param[in] xs      Array of point x coordinates.
+ * \param[in] ys      Array of point y coordinates.
+ * \param[in] order   Array of indexes of the points to draw.
+ * \param[in] count   The number of entries in order.
+ * \param[in] marker  The marker shape to draw at each point.
+ * \param[in] before  The marker extent left of and above each point.
+ * \param[in] after   The marker extent right of and below each point.
+ */
+static void cgifh_points_draw(
+		cgifh_t *img,
+		uint8_t colour,
+		const uint8_t *colours,
+		const int *xs,
+		const int *ys,
+		const size_t *order,
+		size_t count,
+		cgifh_marker_t marker,
+		int before,
+		int after)
+{
+	if (before + after == 0) {
+		/* Single pixel markers; already clipped. */
+		for (size_t i = 0; i < count; i++) {
+			size_t p = order[i];
+
+			cgifh_pixel(img, (colours != NULL) ? colours[p] : colour,
+					xs[p], ys[p]);
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		size_t p = order[i];
+
+		cgifh_points_marker(img,
+				(colours != NULL) ? colours[p] : colour,
+				marker, xs[p], ys[p], before, after);
+	}
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_points(
+		cgifh_t *img,
+		uint8_t colour,
+		const uint8_t *colours,
+		const int *xs,
+		const int *ys,
+		size_t count,
+		cgifh_marker_t marker,
+		int size)
+{
+	uint8_t *visible;
+	size_t *order;
+	size_t *rows;
+	size_t n = 0;
+	int before;
+	int after;
+
+	if (img->clip.x0 >= img->clip.x1 || img->clip.y0 >= img->clip.y1) {
+		/* Nothing can be drawn, as in a culled group. */
+		return;
+	}
+
+	if (size < 1) {
+		size = 1;
+	}
+	before = size / 2;
+	after = size - 1 - before;
+
+	order = cgifh_scratch_alloc(img, (count + (size_t) img->height + 1) *
+			sizeof(*order) + count);
+	if (order == NULL) {
+		/* Fall back to drawing each marker with its own clipping. */
+		for (size_t i = 0; i < count; i++) {
+			uint8_t point_visible;
+
+			cgifh_points_clip(img, &xs[i], &ys[i], 1,
+					before, after, &point_visible);
+			if (point_visible) {
+				cgifh_points_marker(img, (colours != NULL) ?
+						colours[i] : colour,
+						marker, xs[i], ys[i],
+						before, after);
+			}
+		}
+		return;
+	}
+	rows = order + count;
+	visible = (uint8_t *) (rows + img->height + 1);
+
+	cgifh_points_clip(img, xs, ys, count, before, after, visible);
+
+	for (size_t i = 0; i < count; i++) {
+		n += visible[i];
+	}
+
+	/* Drawing order only matters where markers of different colours
+	 * overlap. The row sort is stable, so single pixel markers at the
+	 * same position keep their order. */
+	if (n >= CGIFH_POINTS_SORT_MIN && (colours == NULL || size == 1)) {
+		cgifh_points_sort(img, ys, visible, count, before, rows, order);
+	} else {
+		n = 0;
+		for (size_t i = 0; i < count; i++) {
+			order[n] = i;
+			n += visible[i];
+		}
+	}
+
+	cgifh_points_draw(img, colour, colours, xs, ys, order, n,
+			marker, before, after);
+
+	cgifh_scratch_free(img, order);
+}
@@ -0,0 +1,502 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Work stealing frame rendering thread pool.
+ *
+ * Frame n renders into image n modulo the image count, so at most that many
+ * frames are claimed and not yet output. Threads claim frames from the job
+ * in batches, in frame order, and queue all but the first on their own
+ * queue. Because a queue is only refilled when it is empty, and other
+ * threads only ever take its last frame, each queue is a contiguous range
+ * of frames.
+ *
+ * Lock order is the pool lock, then a queue lock.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cgifh.h>
+
+/** Maximum number of frames a thread claims at once. */
+#define CGIFH_POOL_BATCH 4
+
+/** Default number of frame images for each thread. */
+#define CGIFH_POOL_IMAGES_PER_THREAD 4
+
+/** Maximum number of threads. */
+#define CGIFH_POOL_THREADS_MAX 64
+
+/**
+ * Pool thread.
+ */
+typedef struct cgifh_pool_worker {
+	struct cgifh_pool *pool; /**< The pool the thread belongs to. */
+	cgifh_ctx_t *ctx;        /**< The thread's render context. */
+	pthread_t tid;           /**< The thread. */
+
+	pthread_mutex_t lock; /**< Protects the queue. */
+	size_t first;         /**< First queued frame. */
+	size_t end;           /**< End of the queued frames, exclusive. */
+} cgifh_pool_worker_t;
+
+/**
+ * Thread pool.
+ */
+struct cgifh_pool {
+	pthread_mutex_t lock; /**< Protects everything below. */
+	pthread_cond_t work;  /**< Signalled when there may be frames to take. */
+	pthread_cond_t done;  /**< Signalled when a frame is finished. */
+	uint64_t generation;  /**< Incremented whenever work is signalled. */
+	bool stop;            /**< Whether the threads should exit. */
+
+	const cgifh_frames_t *job; /**< The job being rendered, or NULL. */
+	bool failed;     /**< Whether the job has failed. */
+	size_t claimed;  /**< Number of frames claimed. */
+	size_t finished; /**< Number of claimed frames finished or dropped. */
+	size_t output;   /**< Number of frames output. */
+
+	cgifh_t **images;   /**< Frame images. */
+	bool *ready;        /**< Whether each image holds a rendered frame. */
+	size_t image_count; /**< Number of frame images. */
+
+	size_t worker_count;             /**< Number of threads. */
+	cgifh_pool_worker_t workers[];   /**< The threads. */
+};
+
+/**
+ * Take a frame from the front of a thread's own queue.
+ *
+ * \param[in]  worker The thread.
+ * \param[out] frame  Returns the frame.
+ * \return true if a frame was taken, false if the queue is empty.
+ */
+static bool cgifh_pool_take_own(cgifh_pool_worker_t *worker, size_t *frame)
+{
+	bool taken = false;
+
+	pthread_mutex_lock(&worker->lock);
+	if (worker->first < worker->end) {
+		*frame = worker->first++;
+		taken = true;
+	}
+	pthread_mutex_unlock(&worker->lock);
+
+	return taken;
+}
+
+/**
+ * Claim a batch of frames from the job for a thread.
+ *
+ * The first frame is returned, and the rest are queued on the thread's
+ * queue, which must be empty.
+ *
+ * \param[in]  worker The thread.
+ * \param[out] frame  Returns the first frame.
+ * \return true if frames were claimed, false otherwise.
+ */
+static bool cgifh_pool_take_job(cgifh_pool_worker_t *worker, size_t *frame)
+{
+	cgifh_pool_t *pool = worker->pool;
+	size_t count = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	if (pool->job != NULL && !pool->failed) {
+		size_t frames = pool->job->count - pool->claimed;
+		size_t images = pool->image_count -
+				(pool->claimed - pool->output);
+
+		count = (frames < images) ? frames : images;
+		count = (count < CGIFH_POOL_BATCH) ? count : CGIFH_POOL_BATCH;
+	}
+
+	if (count > 0) {
+		*frame = pool->claimed;
+		pool->claimed += count;
+
+		pthread_mutex_lock(&worker->lock);
+		worker->first = *frame + 1;
+		worker->end = *frame + count;
+		pthread_mutex_unlock(&worker->lock);
+
+		if (count > 1) {
+			/* Let idle threads take some. */
+			pool->generation++;
+			pthread_cond_broadcast(&pool->work);
+		}
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return count > 0;
+}
+
+/**
+ * Take a frame from the back of another thread's queue.
+ *
+ * \param[in]  worker The thread.
+ * \param[out] frame  Returns the frame.
+ * \return true if a frame was taken, false if all the queues are empty.
+ */
+static bool cgifh_pool_take_other(cgifh_pool_worker_t *worker, size_t *frame)
+{
+	cgifh_pool_t *pool = worker->pool;
+	size_t index = (size_t) (worker - pool->workers);
+
+	for (size_t i = 1; i < pool->worker_count; i++) {
+		cgifh_pool_worker_t *victim;
+		bool taken = false;
+
+		victim = &pool->workers[(index + i) % pool->worker_count];
+
+		pthread_mutex_lock(&victim->lock);
+		if (victim->first < victim->end) {
+			*frame = --victim->end;
+			taken = true;
+		}
+		pthread_mutex_unlock(&victim->lock);
+
+		if (taken) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Render a frame.
+ *
+ * Once the job has failed, frames are dropped without rendering.
+ *
+ * \param[in] worker The thread rendering the frame.
+ * \param[in] frame  The frame to render.
+ */
+static void cgifh_pool_render_frame(cgifh_pool_worker_t *worker, size_t frame)
+{
+	cgifh_pool_t *pool = worker->pool;
+	size_t slot = frame % pool->image_count;
+	cgifh_t *img = pool->images[slot];
+	const cgifh_frames_t *job;
+	cgifh_ctx_t *home;
+	bool ok = false;
+
+	pthread_mutex_lock(&pool->lock);
+	job = pool->failed ? NULL : pool->job;
+	pthread_mutex_unlock(&pool->lock);
+
+	if (job != NULL) {
+		/* The image was created in the first thread's context, but
+		 * this thread's context is the one it may use. */
+		home = img->ctx;
+		img->ctx = worker->ctx;
+		img->palette_count = 0;
+		img->group.depth = 0;
+		img->group.culled = 0;
+		cgifh_clip_reset(img);
+
+		ok = job->render(img, frame, job->pw);
+		img->ctx = home;
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	pool->finished++;
+	if (ok) {
+		pool->ready[slot] = true;
+	} else if (!pool->failed) {
+		pool->failed = true;
+		pool->generation++;
+		pthread_cond_broadcast(&pool->work);
+	}
+	pthread_cond_signal(&pool->done);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * Pool thread main function.
+ *
+ * \param[in] pw The \ref cgifh_pool_worker_t.
+ * \return NULL.
+ */
+static void *cgifh_pool_worker_main(void *pw)
+{
+	cgifh_pool_worker_t *worker = pw;
+	cgifh_pool_t *pool = worker->pool;
+
+	while (true) {
+		uint64_t generation;
+		size_t frame;
+
+		pthread_mutex_lock(&pool->lock);
+		generation = pool->generation;
+		if (pool->stop) {
+			pthread_mutex_unlock(&pool->lock);
+			break;
+		}
+		pthread_mutex_unlock(&pool->lock);
+
+		if (cgifh_pool_take_own(worker, &frame) ||
+		    cgifh_pool_take_job(worker, &frame) ||
+		    cgifh_pool_take_other(worker, &frame)) {
+			cgifh_pool_render_frame(worker, frame);
+			continue;
+		}
+
+		/* Nothing to do until something changes. */
+		pthread_mutex_lock(&pool->lock);
+		while (!pool->stop && pool->generation == generation) {
+			pthread_cond_wait(&pool->work, &pool->lock);
+		}
+		pthread_mutex_unlock(&pool->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * Get the number of pool threads to use.
+ *
+ * \param[in] threads The number of threads requested, or 0 for automatic.
+ * \return The number of threads to use.
+ */
+static size_t cgifh_pool_thread_count(unsigned threads)
+{
+	size_t count = threads;
+
+	if (count == 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		count = (cpus > 0) ? (size_t) cpus : 1;
+	}
+
+	if (count > CGIFH_POOL_THREADS_MAX) {
+		count = CGIFH_POOL_THREADS_MAX;
+	}
+
+	return count;
+}
+
+/**
+ * Stop and join a pool's threads.
+ *
+ * \param[in] pool    The pool.
+ * \param[in] started The number of threads that were started.
+ */
+static void cgifh_pool_stop(cgifh_pool_t *pool, size_t started)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = true;
+	pthread_cond_broadcast(&pool->work);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (size_t i = 0; i < started; i++) {
+		pthread_join(pool->workers[i].tid, NULL);
+	}
+}
+
+/**
+ * Destroy a pool's frame images.
+ *
+ * \param[in] pool The pool.
+ */
+static void cgifh_pool_images_destroy(cgifh_pool_t *pool)
+{
+	if (pool->images != NULL) {
+		for (size_t i = 0; i < pool->image_count; i++) {
+			cgifh_destroy(pool->images[i]);
+		}
+	}
+
+	free(pool->images);
+	free(pool->ready);
+	pool->images = NULL;
+	pool->ready = NULL;
+	pool->image_count = 0;
+}
+
+/**
+ * Make sure a pool has the frame images a job needs.
+ *
+ * Must only be called while no job is being rendered.
+ *
+ * \param[in] pool   The pool.
+ * \param[in] frames The job.
+ * \return true on success, false on memory allocation failure.
+ */
+static bool cgifh_pool_images(cgifh_pool_t *pool, const cgifh_frames_t *frames)
+{
+	size_t count = frames->images;
+
+	if (count == 0) {
+		count = pool->worker_count * CGIFH_POOL_IMAGES_PER_THREAD;
+	}
+
+	if (pool->image_count == count &&
+	    (size_t) pool->images[0]->width == frames->width &&
+	    (size_t) pool->images[0]->height == frames->height) {
+		return true;
+	}
+
+	cgifh_pool_images_destroy(pool);
+
+	pool->images = calloc(count, sizeof(*pool->images));
+	pool->ready = calloc(count, sizeof(*pool->ready));
+	if (pool->images == NULL || pool->ready == NULL) {
+		goto error;
+	}
+	pool->image_count = count;
+
+	for (size_t i = 0; i < count; i++) {
+		pool->images[i] = cgifh_ctx_create_image(pool->workers[0].ctx,
+				frames->width, frames->height);
+		if (pool->images[i] == NULL) {
+			goto error;
+		}
+	}
+
+	return true;
+
+error:
+	cgifh_pool_images_destroy(pool);
+	return false;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_pool_t *cgifh_pool_create(
+		unsigned threads,
+		const cgifh_ctx_config_t *config)
+{
+	size_t count = cgifh_pool_thread_count(threads);
+	size_t started = 0;
+	cgifh_pool_t *pool;
+
+	pool = calloc(1, sizeof(*pool) + count * sizeof(pool->workers[0]));
+	if (pool == NULL) {
+		return NULL;
+	}
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	pool->worker_count = count;
+
+	for (size_t i = 0; i < count; i++) {
+		pool->workers[i].pool = pool;
+		pthread_mutex_init(&pool->workers[i].lock, NULL);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		pool->workers[i].ctx = cgifh_ctx_create(config);
+		if (pool->workers[i].ctx == NULL) {
+			goto error;
+		}
+	}
+
+	for (started = 0; started < count; started++) {
+		if (pthread_create(&pool->workers[started].tid, NULL,
+				cgifh_pool_worker_main,
+				&pool->workers[started]) != 0) {
+			goto error;
+		}
+	}
+
+	return pool;
+
+error:
+	cgifh_pool_stop(pool, started);
+	cgifh_pool_destroy(pool);
+	return NULL;
+}
+
+/* Exported function, documented in cgifh.h */
+void cgifh_pool_destroy(cgifh_pool_t *pool)
+{
+	if (pool == NULL) {
+		return;
+	}
+
+	if (!pool->stop) {
+		cgifh_pool_stop(pool, pool->worker_count);
+	}
+
+	cgifh_pool_images_destroy(pool);
+
+	for (size_t i = 0; i < pool->worker_count; i++) {
+		cgifh_ctx_destroy(pool->workers[i].ctx);
+		pthread_mutex_destroy(&pool->workers[i].lock);
+	}
+
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->work);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool);
+}
+
+/* Exported function, documented in cgifh.h */
+bool cgifh_pool_render(
+		cgifh_pool_t *pool,
+		const cgifh_frames_t *frames)
+{
+	bool failed;
+
+	if (frames->count == 0) {
+		return true;
+	}
+
+	if (!cgifh_pool_images(pool, frames)) {
+		return false;
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	pool->job = frames;
+	pool->failed = false;
+	pool->claimed = 0;
+	pool->finished = 0;
+	pool->output = 0;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work);
+
+	while (!pool->failed && pool->output < frames->count) {
+		size_t frame = pool->output;
+		size_t slot = frame % pool->image_count;
+		bool ok;
+
+		if (!pool->ready[slot]) {
+			pthread_cond_wait(&pool->done, &pool->lock);
+			continue;
+		}
+		pthread_mutex_unlock(&pool->lock);
+
+		ok = frames->output(pool->images[slot], frame, frames->pw);
+
+		pthread_mutex_lock(&pool->lock);
+		pool->ready[slot] = false;
+		pool->output++;
+		if (!ok) {
+			pool->failed = true;
+		}
+		pool->generation++;
+		pthread_cond_broadcast(&pool->work);
+	}
+
+	/* Wait for the threads to finish with the claimed frames. */
+	while (pool->finished < pool->claimed) {
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+
+	for (size_t i = 0; i < pool->image_count; i++) {
+		pool->ready[i] = false;
+	}
+	failed = pool->failed;
+	pool->job = NULL;
+	pthread_mutex_unlock(&pool->lock);
+
+	return !failed;
+}
@@ -0,0 +1,459 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Median cut colour quantisation.
+ *
+ * Colours are counted in a histogram with five bits per channel, which also
+ * sums the full precision colours in each bin, so palette entries are exact
+ * means of the colours they represent. The histogram is built in parallel,
+ * with each thread counting a band of rows into its own histogram before
+ * they are merged.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cgifh.h>
+
+/** Histogram bits per channel. */
+#define CGIFH_QUANT_BITS 5
+
+/** Number of histogram bins. */
+#define CGIFH_QUANT_BINS (1U << (3 * CGIFH_QUANT_BITS))
+
+/** Minimum number of pixels for each histogram thread. */
+#define CGIFH_QUANT_PIXELS_PER_THREAD (64U * 1024U)
+
+/** Maximum number of histogram threads. */
+#define CGIFH_QUANT_THREADS_MAX 64
+
+/**
+ * Colour histogram.
+ */
+typedef struct cgifh_quant_hist {
+	uint64_t count[CGIFH_QUANT_BINS]; /**< Pixels in each bin. */
+	/** Sums of the pixels' channel values in each bin. */
+	uint64_t sum[CGIFH_QUANT_BINS][CGIFH_CHANNEL_COUNT];
+} cgifh_quant_hist_t;
+
+/**
+ * Histogram building job for one thread.
+ */
+typedef struct cgifh_quant_job {
+	cgifh_quant_hist_t *hist; /**< Histogram to count into. */
+	const uint8_t *rgb;       /**< First row of RGB pixel data to count. */
+	size_t stride;            /**< Bytes between RGB rows. */
+	size_t width;             /**< Width in pixels. */
+	size_t rows;              /**< Number of rows to count. */
+} cgifh_quant_job_t;
+
+/**
+ * A non-empty histogram bin.
+ */
+typedef struct cgifh_quant_bin {
+	uint8_t pos[CGIFH_CHANNEL_COUNT]; /**< Bin position on each axis. */
+	uint32_t bin;                     /**< Histogram bin index. */
+	uint64_t count;                   /**< Pixels in the bin. */
+} cgifh_quant_bin_t;
+
+/**
+ * Median cut box, spanning a range of the bin array.
+ */
+typedef struct cgifh_quant_box {
+	size_t first;  /**< Index of the box's first bin. */
+	size_t count;  /**< Number of bins in the box. */
+	uint64_t pixels; /**< Number of pixels in the box. */
+	int axis;      /**< Axis with the largest range. */
+	int range;     /**< Range of the box along its largest axis. */
+} cgifh_quant_box_t;
+
+/**
+ * Get the histogram bin for a colour.
+ *
+ * \param[in] p Pointer to the RGB colour.
+ * \return The histogram bin index.
+ */
+static inline uint32_t cgifh_quant_bin_index(const uint8_t *p)
+{
+	enum { R, G, B, SHIFT = 8 - CGIFH_QUANT_BITS };
+
+	return (uint32_t) (p[R] >> SHIFT) << (2 * CGIFH_QUANT_BITS) |
+	       (uint32_t) (p[G] >> SHIFT) << CGIFH_QUANT_BITS |
+	       (uint32_t) (p[B] >> SHIFT);
+}
+
+/**
+ * Count a band of rows into a histogram.
+ *
+ * \param[in] pw The \ref cgifh_quant_job_t.
+ * \return NULL.
+ */
+static void *cgifh_quant_count(void *pw)
+{
+	const cgifh_quant_job_t *job = pw;
+	cgifh_quant_hist_t *hist = job->hist;
+
+	for (size_t row = 0; row < job->rows; row++) {
+		const uint8_t *p = job->rgb + row * job->stride;
+
+		for (size_t col = 0; col < job->width; col++) {
+			uint32_t bin = cgifh_quant_bin_index(p);
+
+			hist->count[bin]++;
+			for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+				hist->sum[bin][c] += p[c];
+			}
+			p += CGIFH_CHANNEL_COUNT;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Get the number of histogram threads to use.
+ *
+ * \param[in] pixels  The number of pixels to count.
+ * \param[in] height  The number of rows to count.
+ * \param[in] threads The number of threads requested, or 0 for automatic.
+ * \return The number of threads to use.
+ */
+static size_t cgifh_quant_thread_count(
+		size_t pixels,
+		size_t height,
+		unsigned threads)
+{
+	size_t count = threads;
+
+	if (count == 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		count = (cpus > 0) ? (size_t) cpus : 1;
+	}
+
+	if (count > pixels / CGIFH_QUANT_PIXELS_PER_THREAD) {
+		count = pixels / CGIFH_QUANT_PIXELS_PER_THREAD;
+	}
+	if (count > height) {
+		count = height;
+	}
+	if (count > CGIFH_QUANT_THREADS_MAX) {
+		count = CGIFH_QUANT_THREADS_MAX;
+	}
+
+	return (count < 1) ? 1 : count;
+}
+
+/**
+ * Build a colour histogram.
+ *
+ * If a thread can't be created, its rows are counted by the calling thread.
+ *
+ * \param[in] rgb     The RGB pixel data.
+ * \param[in] width   Width in pixels.
+ * \param[in] height  Height in pixels.
+ * \param[in] stride  Bytes between RGB rows.
+ * \param[in] threads The number of threads requested, or 0 for automatic.
+ * \return The histogram, or NULL on memory allocation failure.
+ */
+static cgifh_quant_hist_t *cgifh_quant_histogram(
+		const uint8_t *rgb,
+		size_t width,
+		size_t height,
+		size_t stride,
+		unsigned threads)
+{
+	cgifh_quant_job_t jobs[CGIFH_QUANT_THREADS_MAX];
+	pthread_t tids[CGIFH_QUANT_THREADS_MAX];
+	bool started[CGIFH_QUANT_THREADS_MAX];
+	size_t count = cgifh_quant_thread_count(width * height, height,
+			threads);
+	cgifh_quant_hist_t *hists;
+	size_t row = 0;
+
+	hists = calloc(count, sizeof(*hists));
+	if (hists == NULL) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		size_t rows = (height - row) / (count - i);
+
+		jobs[i] = (cgifh_quant_job_t) {
+			.hist = &hists[i],
+			.rgb = rgb + row * stride,
+			.stride = stride,
+			.width = width,
+			.rows = rows,
+		};
+		row += rows;
+
+		/* The calling thread counts the first band itself. */
+		started[i] = (i > 0) && pthread_create(&tids[i], NULL,
+				cgifh_quant_count, &jobs[i]) == 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!started[i]) {
+			cgifh_quant_count(&jobs[i]);
+		}
+	}
+
+	for (size_t i = 1; i < count; i++) {
+		if (started[i]) {
+			pthread_join(tids[i], NULL);
+		}
+		for (uint32_t bin = 0; bin < CGIFH_QUANT_BINS; bin++) {
+			hists[0].count[bin] += hists[i].count[bin];
+			for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+				hists[0].sum[bin][c] += hists[i].sum[bin][c];
+			}
+		}
+	}
+
+	return hists;
+}
+
+/**
+ * Update a box's largest axis and its range.
+ *
+ * \param[in]     bins The bin array.
+ * \param[in,out] box  The box to update.
+ */
+static void cgifh_quant_box_measure(
+		const cgifh_quant_bin_t *bins,
+		cgifh_quant_box_t *box)
+{
+	int lo[CGIFH_CHANNEL_COUNT] = { INT_MAX, INT_MAX, INT_MAX };
+	int hi[CGIFH_CHANNEL_COUNT] = { 0 };
+
+	box->pixels = 0;
+	for (size_t i = box->first; i < box->first + box->count; i++) {
+		for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+			lo[c] = (bins[i].pos[c] < lo[c]) ? bins[i].pos[c] : lo[c];
+			hi[c] = (bins[i].pos[c] > hi[c]) ? bins[i].pos[c] : hi[c];
+		}
+		box->pixels += bins[i].count;
+	}
+
+	box->axis = 0;
+	box->range = hi[0] - lo[0];
+	for (int c = 1; c < CGIFH_CHANNEL_COUNT; c++) {
+		if (hi[c] - lo[c] > box->range) {
+			box->axis = c;
+			box->range = hi[c] - lo[c];
+		}
+	}
+}
+
+/**
+ * Sort a range of bins along an axis.
+ *
+ * Bin positions are small, so this is a counting sort.
+ *
+ * \param[in,out] bins    The bins to sort.
+ * \param[in]     count   The number of bins.
+ * \param[in]     axis    The axis to sort along.
+ * \param[in]     scratch Scratch space for count bins.
+ */
+static void cgifh_quant_sort(
+		cgifh_quant_bin_t *bins,
+		size_t count,
+		int axis,
+		cgifh_quant_bin_t *scratch)
+{
+	size_t start[(1U << CGIFH_QUANT_BITS) + 1] = { 0 };
+
+	for (size_t i = 0; i < count; i++) {
+		start[bins[i].pos[axis] + 1]++;
+	}
+	for (size_t i = 1; i <= (1U << CGIFH_QUANT_BITS); i++) {
+		start[i] += start[i - 1];
+	}
+	for (size_t i = 0; i < count; i++) {
+		scratch[start[bins[i].pos[axis]]++] = bins[i];
+	}
+	for (size_t i = 0; i < count; i++) {
+		bins[i] = scratch[i];
+	}
+}
+
+/**
+ * Split boxes until there are enough, or no more can be split.
+ *
+ * The box with the most pixels times range is split at its median pixel
+ * along its largest axis.
+ *
+ * \param[in,out] bins      The bin array.
+ * \param[in]     scratch   Scratch space for as many bins as the array.
+ * \param[in,out] boxes     Array of boxes, with the first box set up.
+ * \param[in]     max_boxes The maximum number of boxes.
+ * \return The number of boxes.
+ */
+static unsigned cgifh_quant_split(
+		cgifh_quant_bin_t *bins,
+		cgifh_quant_bin_t *scratch,
+		cgifh_quant_box_t *boxes,
+		unsigned max_boxes)
+{
+	unsigned count = 1;
+
+	while (count < max_boxes) {
+		cgifh_quant_box_t *box = NULL;
+		uint64_t best = 0;
+		uint64_t half;
+		uint64_t seen = 0;
+		size_t split;
+
+		for (unsigned i = 0; i < count; i++) {
+			uint64_t score = boxes[i].pixels *
+					(uint64_t) boxes[i].range;
+
+			if (boxes[i].count > 1 && score > best) {
+				best = score;
+				box = &boxes[i];
+			}
+		}
+		if (box == NULL) {
+			break;
+		}
+
+		cgifh_quant_sort(bins + box->first, box->count, box->axis,
+				scratch);
+
+		half = box->pixels / 2;
+		for (split = 1; split < box->count - 1; split++) {
+			seen += bins[box->first + split - 1].count;
+			if (seen >= half) {
+				break;
+			}
+		}
+
+		boxes[count] = (cgifh_quant_box_t) {
+			.first = box->first + split,
+			.count = box->count - split,
+		};
+		box->count = split;
+		cgifh_quant_box_measure(bins, box);
+		cgifh_quant_box_measure(bins, &boxes[count]);
+		count++;
+	}
+
+	return count;
+}
+
+/**
+ * Build a palette for a colour histogram.
+ *
+ * \param[in] img         The image to add the palette to.
+ * \param[in] hist        The colour histogram.
+ * \param[in] max_colours The maximum number of palette entries.
+ * \return true on success, false on memory allocation failure.
+ */
+static bool cgifh_quant_palette(
+		cgifh_t *img,
+		const cgifh_quant_hist_t *hist,
+		unsigned max_colours)
+{
+	cgifh_quant_box_t boxes[CGIFH_PALETTE_MAX];
+	cgifh_quant_bin_t *scratch;
+	cgifh_quant_bin_t *bins;
+	unsigned box_count;
+	size_t count = 0;
+
+	bins = malloc(2 * CGIFH_QUANT_BINS * sizeof(*bins));
+	if (bins == NULL) {
+		return false;
+	}
+	scratch = bins + CGIFH_QUANT_BINS;
+
+	for (uint32_t bin = 0; bin < CGIFH_QUANT_BINS; bin++) {
+		if (hist->count[bin] != 0) {
+			bins[count++] = (cgifh_quant_bin_t) {
+				.pos = {
+					(uint8_t) (bin >> (2 * CGIFH_QUANT_BITS)),
+					(uint8_t) (bin >> CGIFH_QUANT_BITS &
+						((1U << CGIFH_QUANT_BITS) - 1)),
+					(uint8_t) (bin &
+						((1U << CGIFH_QUANT_BITS) - 1)),
+				},
+				.bin = bin,
+				.count = hist->count[bin],
+			};
+		}
+	}
+
+	boxes[0] = (cgifh_quant_box_t) {
+		.first = 0,
+		.count = count,
+	};
+	cgifh_quant_box_measure(bins, &boxes[0]);
+	box_count = cgifh_quant_split(bins, scratch, boxes, max_colours);
+
+	for (unsigned i = 0; i < box_count; i++) {
+		uint64_t sum[CGIFH_CHANNEL_COUNT] = { 0 };
+		uint8_t mean[CGIFH_CHANNEL_COUNT];
+		uint64_t pixels = boxes[i].pixels;
+
+		for (size_t b = boxes[i].first;
+				b < boxes[i].first + boxes[i].count; b++) {
+			for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+				sum[c] += hist->sum[bins[b].bin][c];
+			}
+		}
+		for (int c = 0; c < CGIFH_CHANNEL_COUNT; c++) {
+			mean[c] = (uint8_t) ((sum[c] + pixels / 2) / pixels);
+		}
+
+		cgifh_palette_add(img, mean[0], mean[1], mean[2], NULL);
+	}
+
+	free(bins);
+	return true;
+}
+
+/* Exported function, documented in cgifh.h */
+cgifh_t *cgifh_create_from_rgb(
+		const uint8_t *rgb,
+		size_t width,
+		size_t height,
+		size_t stride,
+		unsigned max_colours,
+		cgifh_dither_t dither,
+		unsigned threads)
+{
+	cgifh_quant_hist_t *hist;
+	cgifh_t *img;
+
+	if (max_colours < 1 || max_colours > CGIFH_PALETTE_MAX) {
+		return NULL;
+	}
+
+	img = cgifh_create(width, height);
+	if (img == NULL) {
+		return NULL;
+	}
+
+	hist = cgifh_quant_histogram(rgb, width, height, stride, threads);
+	if (hist == NULL) {
+		cgifh_destroy(img);
+		return NULL;
+	}
+
+	if (!cgifh_quant_palette(img, hist, max_colours) ||
+	    !cgifh_rgb_to_index(img, dither, rgb, stride, 0, 0,
+			(int) width, (int) height)) {
+		free(hist);
+		cgifh_destroy(img);
+		return NULL;
+	}
+
+	free(hist);
+	return img;
+}
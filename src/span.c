@@ -0,0 +1,418 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Span fill and copy kernels.
+ *
+ * Ordinary spans are written with memset and memcpy, which the C library
+ * already optimises for the host CPU. Streaming spans use kernels built here
+ * for each supported instruction set, with the best one the CPU supports
+ * selected at runtime. This lets a single binary run on any CPU of the
+ * target architecture.
+ */
+
+#include <string.h>
+
+#include "span.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CGIFH_SPAN_X86 1
+#include <immintrin.h>
+#else
+#define CGIFH_SPAN_X86 0
+#endif
+
+#if defined(__GNUC__) && defined(__aarch64__)
+#define CGIFH_SPAN_NEON 1
+#include <arm_neon.h>
+#else
+#define CGIFH_SPAN_NEON 0
+#endif
+
+/**
+ * A set of span kernels for a particular instruction set.
+ */
+typedef struct cgifh_span_kernels {
+	/** Fill a span with a colour. */
+	void (*fill)(uint8_t *dst, uint8_t colour, size_t len);
+	/** Copy a span. */
+	void (*copy)(uint8_t *dst, const uint8_t *src, size_t len);
+	/** Order preceding stores before later stores. */
+	void (*fence)(void);
+} cgifh_span_kernels_t;
+
+/**
+ * Get the number of bytes before a pointer is aligned.
+ *
+ * \param[in] ptr   The pointer to check.
+ * \param[in] len   The length of the span at ptr.
+ * \param[in] align The required alignment; must be a power of two.
+ * \return The number of leading bytes to write with ordinary stores.
+ */
+static inline size_t cgifh_span_head(
+		const uint8_t *ptr,
+		size_t len,
+		size_t align)
+{
+	size_t head = (size_t) (-(uintptr_t) ptr & (align - 1));
+
+	return (head < len) ? head : len;
+}
+
+/**
+ * Fill a span with ordinary stores.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ */
+static void cgifh_span_fill_generic(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len)
+{
+	memset(dst, colour, len);
+}
+
+/**
+ * Copy a span with ordinary stores.
+ *
+ * \param[in] dst The span to copy to.
+ * \param[in] src The span to copy from.
+ * \param[in] len The length of the span in pixels.
+ */
+static void cgifh_span_copy_generic(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len)
+{
+	memcpy(dst, src, len);
+}
+
+/**
+ * Ordinary stores need no fence.
+ */
+static void cgifh_span_fence_generic(void)
+{
+}
+
+/** Kernels which use ordinary stores. */
+static const cgifh_span_kernels_t cgifh_span_generic = {
+	.fill  = cgifh_span_fill_generic,
+	.copy  = cgifh_span_copy_generic,
+	.fence = cgifh_span_fence_generic,
+};
+
+#if CGIFH_SPAN_X86
+
+/**
+ * Fill a span using SSE2 streaming stores.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ */
+__attribute__((target("sse2")))
+static void cgifh_span_fill_sse2(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len)
+{
+	__m128i v = _mm_set1_epi8((char) colour);
+	size_t head = cgifh_span_head(dst, len, 16);
+	size_t i;
+
+	memset(dst, colour, head);
+	for (i = head; i + 16 <= len; i += 16) {
+		_mm_stream_si128((__m128i *) (void *) (dst + i), v);
+	}
+	memset(dst + i, colour, len - i);
+}
+
+/**
+ * Copy a span using SSE2 streaming stores.
+ *
+ * \param[in] dst The span to copy to.
+ * \param[in] src The span to copy from.
+ * \param[in] len The length of the span in pixels.
+ */
+__attribute__((target("sse2")))
+static void cgifh_span_copy_sse2(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len)
+{
+	size_t head = cgifh_span_head(dst, len, 16);
+	size_t i;
+
+	memcpy(dst, src, head);
+	for (i = head; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128(
+				(const __m128i *) (const void *) (src + i));
+		_mm_stream_si128((__m128i *) (void *) (dst + i), v);
+	}
+	memcpy(dst + i, src + i, len - i);
+}
+
+/**
+ * Order streaming stores before later stores.
+ */
+__attribute__((target("sse2")))
+static void cgifh_span_fence_sse2(void)
+{
+	_mm_sfence();
+}
+
+/** Kernels which use SSE2 streaming stores. */
+static const cgifh_span_kernels_t cgifh_span_sse2 = {
+	.fill  = cgifh_span_fill_sse2,
+	.copy  = cgifh_span_copy_sse2,
+	.fence = cgifh_span_fence_sse2,
+};
+
+/**
+ * Fill a span using AVX2 streaming stores.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ */
+__attribute__((target("avx2")))
+static void cgifh_span_fill_avx2(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len)
+{
+	__m256i v = _mm256_set1_epi8((char) colour);
+	size_t head = cgifh_span_head(dst, len, 32);
+	size_t i;
+
+	memset(dst, colour, head);
+	for (i = head; i + 32 <= len; i += 32) {
+		_mm256_stream_si256((__m256i *) (void *) (dst + i), v);
+	}
+	memset(dst + i, colour, len - i);
+}
+
+/**
+ * Copy a span using AVX2 streaming stores.
+ *
+ * \param[in] dst The span to copy to.
+ * \param[in] src The span to copy from.
+ * \param[in] len The length of the span in pixels.
+ */
+__attribute__((target("avx2")))
+static void cgifh_span_copy_avx2(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len)
+{
+	size_t head = cgifh_span_head(dst, len, 32);
+	size_t i;
+
+	memcpy(dst, src, head);
+	for (i = head; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256(
+				(const __m256i *) (const void *) (src + i));
+		_mm256_stream_si256((__m256i *) (void *) (dst + i), v);
+	}
+	memcpy(dst + i, src + i, len - i);
+}
+
+/** Kernels which use AVX2 streaming stores. */
+static const cgifh_span_kernels_t cgifh_span_avx2 = {
+	.fill  = cgifh_span_fill_avx2,
+	.copy  = cgifh_span_copy_avx2,
+	.fence = cgifh_span_fence_sse2,
+};
+
+/**
+ * Fill a span using AVX-512 streaming stores.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ */
+__attribute__((target("avx512f")))
+static void cgifh_span_fill_avx512(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len)
+{
+	__m512i v = _mm512_set1_epi8((char) colour);
+	size_t head = cgifh_span_head(dst, len, 64);
+	size_t i;
+
+	memset(dst, colour, head);
+	for (i = head; i + 64 <= len; i += 64) {
+		_mm512_stream_si512((void *) (dst + i), v);
+	}
+	memset(dst + i, colour, len - i);
+}
+
+/**
+ * Copy a span using AVX-512 streaming stores.
+ *
+ * \param[in] dst The span to copy to.
+ * \param[in] src The span to copy from.
+ * \param[in] len The length of the span in pixels.
+ */
+__attribute__((target("avx512f")))
+static void cgifh_span_copy_avx512(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len)
+{
+	size_t head = cgifh_span_head(dst, len, 64);
+	size_t i;
+
+	memcpy(dst, src, head);
+	for (i = head; i + 64 <= len; i += 64) {
+		__m512i v = _mm512_loadu_si512((const void *) (src + i));
+		_mm512_stream_si512((void *) (dst + i), v);
+	}
+	memcpy(dst + i, src + i, len - i);
+}
+
+/** Kernels which use AVX-512 streaming stores. */
+static const cgifh_span_kernels_t cgifh_span_avx512 = {
+	.fill  = cgifh_span_fill_avx512,
+	.copy  = cgifh_span_copy_avx512,
+	.fence = cgifh_span_fence_sse2,
+};
+
+#endif /* CGIFH_SPAN_X86 */
+
+#if CGIFH_SPAN_NEON
+
+/**
+ * Fill a span using NEON non-temporal pair stores.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ */
+static void cgifh_span_fill_neon(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len)
+{
+	uint8x16_t v = vdupq_n_u8(colour);
+	size_t head = cgifh_span_head(dst, len, 16);
+	size_t i;
+
+	memset(dst, colour, head);
+	for (i = head; i + 32 <= len; i += 32) {
+		__asm__ volatile ("stnp %q1, %q1, [%0]"
+				: : "r" (dst + i), "w" (v) : "memory");
+	}
+	memset(dst + i, colour, len - i);
+}
+
+/**
+ * Copy a span using NEON non-temporal pair stores.
+ *
+ * \param[in] dst The span to copy to.
+ * \param[in] src The span to copy from.
+ * \param[in] len The length of the span in pixels.
+ */
+static void cgifh_span_copy_neon(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len)
+{
+	size_t head = cgifh_span_head(dst, len, 16);
+	size_t i;
+
+	memcpy(dst, src, head);
+	for (i = head; i + 32 <= len; i += 32) {
+		uint8x16_t v0 = vld1q_u8(src + i);
+		uint8x16_t v1 = vld1q_u8(src + i + 16);
+
+		__asm__ volatile ("stnp %q1, %q2, [%0]"
+				: : "r" (dst + i), "w" (v0), "w" (v1)
+				: "memory");
+	}
+	memcpy(dst + i, src + i, len - i);
+}
+
+/**
+ * Order non-temporal stores before later stores.
+ */
+static void cgifh_span_fence_neon(void)
+{
+	__asm__ volatile ("dmb ishst" : : : "memory");
+}
+
+/** Kernels which use NEON non-temporal stores. */
+static const cgifh_span_kernels_t cgifh_span_neon = {
+	.fill  = cgifh_span_fill_neon,
+	.copy  = cgifh_span_copy_neon,
+	.fence = cgifh_span_fence_neon,
+};
+
+#endif /* CGIFH_SPAN_NEON */
+
+/**
+ * Get the best span kernels for the CPU.
+ *
+ * The CPU feature checks read state the compiler runtime sets up at
+ * startup, so this is cheap enough to call per operation and needs no
+ * shared mutable state of its own.
+ *
+ * \param[in] stream Whether streaming stores are wanted.
+ * \return The kernels to use.
+ */
+static inline const cgifh_span_kernels_t *cgifh_span_kernels(bool stream)
+{
+	if (!stream) {
+		return &cgifh_span_generic;
+	}
+
+#if CGIFH_SPAN_X86
+	if (__builtin_cpu_supports("avx512f")) {
+		return &cgifh_span_avx512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return &cgifh_span_avx2;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		return &cgifh_span_sse2;
+	}
+#elif CGIFH_SPAN_NEON
+	return &cgifh_span_neon;
+#endif
+
+	return &cgifh_span_generic;
+}
+
+/* Internal function, documented in span.h */
+void cgifh_span_fill(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len,
+		bool stream)
+{
+	cgifh_span_kernels(stream)->fill(dst, colour, len);
+}
+
+/* Internal function, documented in span.h */
+void cgifh_span_copy(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len,
+		bool stream)
+{
+	cgifh_span_kernels(stream)->copy(dst, src, len);
+}
+
+/* Internal function, documented in span.h */
+void cgifh_span_fence(bool stream)
+{
+	if (stream) {
+		cgifh_span_kernels(stream)->fence();
+	}
+}
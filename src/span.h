@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+#ifndef CGIFH_SPAN_H
+#define CGIFH_SPAN_H
+
+/**
+ * \file Span fill and copy kernels.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Operation size in bytes at which spans are written with streaming stores.
+ *
+ * Operations at least this big would evict most of the cache, so their
+ * writes bypass it instead. This leaves the cache for data that will be
+ * read again soon, such as the encoder's working set.
+ */
+#ifndef CGIFH_STREAM_THRESHOLD
+#define CGIFH_STREAM_THRESHOLD (1U << 20)
+#endif
+
+/**
+ * Check whether an operation should use streaming stores.
+ *
+ * \param[in] size The total number of bytes the operation will write.
+ * \return true if the operation should use streaming stores.
+ */
+static inline bool cgifh_span_stream(size_t size)
+{
+	return size >= CGIFH_STREAM_THRESHOLD;
+}
+
+/**
+ * Fill a span of pixels with a colour.
+ *
+ * \param[in] dst    The span to fill.
+ * \param[in] colour The palette index to fill the span with.
+ * \param[in] len    The length of the span in pixels.
+ * \param[in] stream Whether to use streaming stores, if available.
+ */
+void cgifh_span_fill(
+		uint8_t *dst,
+		uint8_t colour,
+		size_t len,
+		bool stream);
+
+/**
+ * Copy a span of pixels.
+ *
+ * The spans must not overlap.
+ *
+ * \param[in] dst    The span to copy to.
+ * \param[in] src    The span to copy from.
+ * \param[in] len    The length of the span in pixels.
+ * \param[in] stream Whether to use streaming stores, if available.
+ */
+void cgifh_span_copy(
+		uint8_t *dst,
+		const uint8_t *src,
+		size_t len,
+		bool stream);
+
+/**
+ * Complete an operation's streaming stores.
+ *
+ * Streaming stores are weakly ordered, so this must be called at the end of
+ * any operation that passed stream as true to the span functions.
+ *
+ * \param[in] stream Whether the operation used streaming stores.
+ */
+void cgifh_span_fence(bool stream);
+
+#endif /* CGIFH_SPAN_H */
@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Band drawing tests.
+ *
+ * Draws in bands inside a culled group, and checks that the group still
+ * restores the image's clip rectangle when it ends.
+ */
+
+#include <stdio.h>
+
+#include <cgifh.h>
+
+/** Test image size in pixels. */
+#define TEST_SIZE 64
+
+/**
+ * Draw callback that fills its band image.
+ *
+ * \param[in] img The band image.
+ * \param[in] pw  Unused.
+ */
+static void test_fill(cgifh_t *img, void *pw)
+{
+	(void) pw;
+
+	cgifh_rect_fill(img, 1, 0, 0, TEST_SIZE, TEST_SIZE);
+}
+
+/**
+ * Draw in bands inside a culled group.
+ *
+ * \param[in] bands The number of bands.
+ * \return true if the test passed, false otherwise.
+ */
+static bool test_culled_group(unsigned bands)
+{
+	cgifh_t *img = cgifh_create(TEST_SIZE, TEST_SIZE);
+	bool pass = false;
+	cgifh_rect_t clip;
+
+	if (img == NULL) {
+		goto cleanup;
+	}
+
+	cgifh_clear(img, 0);
+	cgifh_clip_set(img, 4, 4, 16, 16);
+
+	if (cgifh_group_begin(img, 100, 100, 5, 5)) {
+		goto cleanup;
+	}
+	cgifh_draw_bands(img, bands, NULL, test_fill, NULL);
+	cgifh_group_end(img);
+
+	/* Nothing was drawn during the group. */
+	for (int y = 0; y < TEST_SIZE; y++) {
+		for (int x = 0; x < TEST_SIZE; x++) {
+			if (cgifh_row(img, y)[x] != 0) {
+				goto cleanup;
+			}
+		}
+	}
+
+	clip = cgifh_clip_get(img);
+	if (clip.x != 4 || clip.y != 4 || clip.w != 16 || clip.h != 16) {
+		goto cleanup;
+	}
+
+	/* Drawing after the group is not dropped. */
+	test_fill(img, NULL);
+	pass = cgifh_row(img, 4)[4] == 1 && cgifh_row(img, 20)[20] == 0;
+
+cleanup:
+	cgifh_destroy(img);
+	return pass;
+}
+
+/**
+ * Test entry point.
+ *
+ * \return 0 on success, 1 on failure.
+ */
+int main(void)
+{
+	int failures = 0;
+
+	for (unsigned bands = 1; bands <= 4; bands++) {
+		if (!test_culled_group(bands)) {
+			printf("FAIL: culled group, %u bands\n", bands);
+			failures++;
+		}
+	}
+
+	printf("bands: %s\n", (failures == 0) ? "pass" : "FAIL");
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Point drawing tests.
+ *
+ * Draws enough visible points for them to be sorted by row, mixed with
+ * points far outside the image, and checks the result against drawing
+ * the points one at a time. The points are also drawn with allocation
+ * failing, to test the unsorted fallback.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+/** Test image size in pixels. */
+#define TEST_SIZE 64
+
+/** Number of points, of which every fourth is far off the image. */
+#define TEST_POINTS 2000
+
+/** Whether the test allocator fails. */
+static bool test_alloc_fail;
+
+/**
+ * Test allocator allocation function.
+ *
+ * \param[in] pw   Unused.
+ * \param[in] size Number of bytes to allocate.
+ * \return The memory, or NULL if allocation is set to fail.
+ */
+static void *test_alloc(void *pw, size_t size)
+{
+	(void) pw;
+
+	return test_alloc_fail ? NULL : malloc(size);
+}
+
+/**
+ * Test allocator free function.
+ *
+ * \param[in] pw  Unused.
+ * \param[in] ptr Memory to free.
+ */
+static void test_free(void *pw, void *ptr)
+{
+	(void) pw;
+
+	free(ptr);
+}
+
+/**
+ * Draw points and compare them with drawing each point alone.
+ *
+ * \param[in] xs      Array of point x coordinates.
+ * \param[in] ys      Array of point y coordinates.
+ * \param[in] colours Array of point colours, or NULL.
+ * \param[in] marker  The marker shape.
+ * \param[in] size    The marker size.
+ * \param[in] fail    Whether to draw the points with allocation failing.
+ * \return true if the images match, false otherwise.
+ */
+static bool test_points(
+		const int *xs,
+		const int *ys,
+		const uint8_t *colours,
+		cgifh_marker_t marker,
+		int size,
+		bool fail)
+{
+	static const cgifh_allocator_t allocator = {
+		.alloc = test_alloc,
+		.free = test_free,
+	};
+	const cgifh_ctx_config_t config = {
+		.allocator = &allocator,
+	};
+	cgifh_ctx_t *ctx = cgifh_ctx_create(&config);
+	cgifh_t *img = cgifh_ctx_create_image(ctx, TEST_SIZE, TEST_SIZE);
+	cgifh_t *ref = cgifh_create(TEST_SIZE, TEST_SIZE);
+	bool match = false;
+
+	if (img == NULL || ref == NULL) {
+		goto cleanup;
+	}
+
+	cgifh_clear(img, 0);
+	cgifh_clear(ref, 0);
+
+	test_alloc_fail = fail;
+	cgifh_points(img, 1, colours, xs, ys, TEST_POINTS, marker, size);
+	test_alloc_fail = false;
+
+	for (size_t i = 0; i < TEST_POINTS; i++) {
+		cgifh_points(ref, 1, (colours != NULL) ? &colours[i] : NULL,
+				&xs[i], &ys[i], 1, marker, size);
+	}
+
+	match = memcmp(img->data, ref->data, img->size) == 0;
+
+cleanup:
+	cgifh_destroy(img);
+	cgifh_destroy(ref);
+	cgifh_ctx_destroy(ctx);
+	return match;
+}
+
+/**
+ * Test entry point.
+ *
+ * \return 0 on success, 1 on failure.
+ */
+int main(void)
+{
+	static const int far[] = {
+		100000000, -100000000, INT_MAX, INT_MIN,
+	};
+	static const struct {
+		cgifh_marker_t marker;
+		const char *name;
+	} markers[] = {
+		{ CGIFH_MARKER_SQUARE, "square" },
+		{ CGIFH_MARKER_PLUS,   "plus" },
+		{ CGIFH_MARKER_CROSS,  "cross" },
+	};
+	static uint8_t colours[TEST_POINTS];
+	static int xs[TEST_POINTS];
+	static int ys[TEST_POINTS];
+	int failures = 0;
+
+	for (int i = 0; i < TEST_POINTS; i++) {
+		xs[i] = (i * 7919) % (TEST_SIZE + 8) - 4;
+		ys[i] = (i * 104729) % (TEST_SIZE + 8) - 4;
+		if (i % 4 == 0) {
+			ys[i] = far[(i / 4) % 4];
+		} else if (i % 8 == 1) {
+			xs[i] = far[(i / 8) % 4];
+		}
+		colours[i] = (uint8_t) (1 + i % 5);
+	}
+
+	for (size_t m = 0; m < sizeof(markers) / sizeof(markers[0]); m++) {
+		for (int size = 1; size <= 5; size += 2) {
+			for (int variant = 0; variant < 4; variant++) {
+				bool coloured = (variant & 1) != 0;
+				bool fail = (variant & 2) != 0;
+
+				if (test_points(xs, ys,
+						coloured ? colours : NULL,
+						markers[m].marker, size,
+						fail)) {
+					continue;
+				}
+				printf("FAIL: %s markers, size %d%s%s\n",
+						markers[m].name, size,
+						coloured ? ", coloured" : "",
+						fail ? ", allocation failing" :
+						"");
+				failures++;
+			}
+		}
+	}
+
+	printf("points: %s\n", (failures == 0) ? "pass" : "FAIL");
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2024 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file Font compiler.
+ *
+ * Compiles the built-in font's glyph bitmaps, authored in src/font.c, into
+ * the span and column tables, bounding boxes and glyph map the renderer
+ * draws from.
+ * The result is written to stdout as C source defining cgifh_font_builtin.
+ *
+ * The spans are built by the same code that builds them for fonts loaded
+ * at run time, so compiled and loaded fonts are drawn identically.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cgifh.h>
+
+#include "font.h"
+
+/**
+ * Write a code point as a C comment.
+ *
+ * \param[in] cp The code point.
+ */
+static void fontc_comment(uint32_t cp)
+{
+	if (cp >= CGIFH_FONT_ASCII) {
+		printf("/* U+%04" PRIX32 " */", cp);
+	} else if (cp == '/' || cp == '*' || cp == '\\' || cp < ' ') {
+		printf("/* 0x%02" PRIx32 " */", cp);
+	} else {
+		printf("/* '%c' */", (char) cp);
+	}
+}
+
+/**
+ * Find the code point of each of a font's glyphs.
+ *
+ * \param[in]  font The font.
+ * \param[out] cps  Returns the code point of each glyph.
+ */
+static void fontc_code_points(const cgifh_font_t *font, uint32_t *cps)
+{
+	uint32_t end = font->block_count << CGIFH_FONT_BLOCK_BITS;
+
+	for (uint32_t cp = 0; cp < CGIFH_FONT_ASCII; cp++) {
+		cps[cp] = cp;
+	}
+
+	for (uint32_t cp = CGIFH_FONT_ASCII; cp < end; cp++) {
+		const cgifh_glyph_t *glyph = cgifh_font_glyph(font, cp);
+
+		if (glyph != NULL) {
+			cps[glyph - font->glyphs] = cp;
+		}
+	}
+}
+
+/**
+ * Font compiler entry point.
+ *
+ * \return Program exit code.
+ */
+int main(void)
+{
+	uint8_t bitmap[CGIFH_GLYPH_COUNT][CGIFH_GLYPH_HEIGHT];
+	uint8_t advances[CGIFH_GLYPH_COUNT];
+	uint32_t *cps;
+	cgifh_font_t *font;
+	size_t column_offset = 0;
+	size_t offset = 0;
+	uint32_t map_count = 1;
+
+	for (unsigned c = 0; c < CGIFH_GLYPH_COUNT; c++) {
+		memcpy(bitmap[c], font_h8[c].data, CGIFH_GLYPH_HEIGHT);
+		advances[c] = (uint8_t) font_h8[c].advance;
+	}
+
+	font = cgifh_font_create(CGIFH_GLYPH_WIDTH, CGIFH_GLYPH_HEIGHT,
+			0, CGIFH_GLYPH_COUNT, advances, &bitmap[0][0]);
+	if (font == NULL) {
+		fprintf(stderr, "fontc: Failed to compile font\n");
+		return EXIT_FAILURE;
+	}
+
+	cps = calloc(font->glyph_count, sizeof(*cps));
+	if (cps == NULL) {
+		fprintf(stderr, "fontc: Out of memory\n");
+		cgifh_font_destroy(font);
+		return EXIT_FAILURE;
+	}
+	fontc_code_points(font, cps);
+
+	for (uint32_t i = 0; i < font->block_count; i++) {
+		if (font->blocks[i] >= map_count) {
+			map_count = font->blocks[i] + 1u;
+		}
+	}
+
+	printf("/* Generated by tools/fontc from src/font.c. Do not edit. */\n"
+	       "\n"
+	       "#include \"font.h\"\n"
+	       "\n"
+	       "/** Spans of the built-in font's glyphs. */\n"
+	       "static const cgifh_glyph_span_t font_h8_spans[] = {\n");
+	for (unsigned i = 0; i < font->glyph_count; i++) {
+		const cgifh_glyph_t *glyph = &font->glyphs[i];
+
+		if (glyph->span_count == 0) {
+			continue;
+		}
+		printf("\t");
+		fontc_comment(cps[i]);
+		printf("\n");
+		for (unsigned s = 0; s < glyph->span_count; s++) {
+			const cgifh_glyph_span_t *span = &glyph->spans[s];
+
+			printf("\t{ .row = %u, .x0 = %u, .x1 = %u },\n",
+					span->row, span->x0, span->x1);
+		}
+	}
+	printf("};\n"
+	       "\n"
+	       "/** Columns of the built-in font's glyphs. */\n"
+	       "static const cgifh_glyph_span_t font_h8_columns[] = {\n");
+	for (unsigned i = 0; i < font->glyph_count; i++) {
+		const cgifh_glyph_t *glyph = &font->glyphs[i];
+
+		if (glyph->column_count == 0) {
+			continue;
+		}
+		printf("\t");
+		fontc_comment(cps[i]);
+		printf("\n");
+		for (unsigned s = 0; s < glyph->column_count; s++) {
+			const cgifh_glyph_span_t *col = &glyph->columns[s];
+
+			printf("\t{ .row = %u, .x0 = %u, .x1 = %u },\n",
+					col->row, col->x0, col->x1);
+		}
+	}
+	printf("};\n"
+	       "\n"
+	       "/** Glyphs of the built-in font, ASCII first. */\n"
+	       "static const cgifh_glyph_t font_h8_glyphs[%u] = {\n",
+			font->glyph_count);
+	for (unsigned i = 0; i < font->glyph_count; i++) {
+		const cgifh_glyph_t *glyph = &font->glyphs[i];
+
+		if (glyph->advance == 0 && glyph->span_count == 0) {
+			continue;
+		}
+		printf("\t[%u] = { ", i);
+		fontc_comment(cps[i]);
+		printf("\n"
+		       "\t\t.advance = %d,\n"
+		       "\t\t.spans = &font_h8_spans[%zu],\n"
+		       "\t\t.span_count = %u,\n"
+		       "\t\t.columns = &font_h8_columns[%zu],\n"
+		       "\t\t.column_count = %u,\n"
+		       "\t\t.box = { %u, %u, %u, %u },\n"
+		       "\t},\n",
+				glyph->advance, offset, glyph->span_count,
+				column_offset, glyph->column_count,
+				glyph->box.x0, glyph->box.y0,
+				glyph->box.x1, glyph->box.y1);
+		offset += glyph->span_count;
+		column_offset += glyph->column_count;
+	}
+	printf("};\n"
+	       "\n"
+	       "/** First level of the built-in font's glyph map. */\n"
+	       "static const uint16_t font_h8_blocks[%" PRIu32 "] = {",
+			font->block_count);
+	for (uint32_t i = 0; i < font->block_count; i++) {
+		printf("%s%u,", (i % 8 == 0) ? "\n\t" : " ", font->blocks[i]);
+	}
+	printf("\n};\n"
+	       "\n"
+	       "/** Second level of the built-in font's glyph map. */\n"
+	       "static const uint16_t font_h8_map[%" PRIu32 "][%u] = {\n",
+			map_count, CGIFH_FONT_BLOCK_SIZE);
+	for (uint32_t m = 0; m < map_count; m++) {
+		printf("\t{");
+		for (unsigned i = 0; i < CGIFH_FONT_BLOCK_SIZE; i++) {
+			printf("%s%u,", (i % 8 == 0) ? "\n\t\t" : " ",
+					font->map[m][i]);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n"
+	       "\n"
+	       "/* Internal data, documented in font.h */\n"
+	       "const cgifh_font_t cgifh_font_builtin = {\n"
+	       "\t.width = %d,\n"
+	       "\t.height = %d,\n"
+	       "\t.overhang = %d,\n"
+	       "\t.glyph_count = %u,\n"
+	       "\t.glyphs = font_h8_glyphs,\n"
+	       "\t.block_count = %" PRIu32 ",\n"
+	       "\t.blocks = font_h8_blocks,\n"
+	       "\t.map = font_h8_map,\n"
+	       "};\n",
+			font->width, font->height, font->overhang,
+			font->glyph_count, font->block_count);
+
+	free(cps);
+	cgifh_font_destroy(font);
+
+	return (fflush(stdout) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}